@@ -627,9 +627,9 @@ void Subgraph::data_flow_transformations(const std::vector<snippets::pass::Manag
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
-    // todo: presently dynamic pipeline is activated even if the last two dimension are static
-    //  In general, we can use static kernels in this case, but several parameters (src and dst memory pointers for example)
-    //  should be passed as run-time args, so it's a mixed mode: kernel is shape-aware, but some additional runtime args are required
+    // Note: when the last dimensions are static, the plugin may generate the kernel for the innermost dimension only and pass
+    //  the offsets of the src and dst memory pointers for the outer dimensions as run-time args (see jit_snippets_compile_args),
+    //  so it's a mixed mode: kernel is shape-aware in the innermost dimension only and is shared by the other shapes
     // Presently Broadcasting is organized in the following way:
     // * ALL last dims are static => broadcasting is handled via MoveBroadcast and pointer arithmetics (even for dynamic upper dims)
     if (!inputs_has_dynamic_last_dims) {
@@ -26,6 +26,7 @@
 #include "transformations/fp16_compression/mark_subgraphs_to_keep_in_mixed_precision.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/disable_fp16_compression.hpp"
+#include "transformations/rt_info/keep_const_precision.hpp"
 #include "transformations/rt_info/keep_fp16_const.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -1126,6 +1127,9 @@ bool fuse_type_to_constant(const std::shared_ptr<ov::Node>& node,
     // Consts marked with disable_constant_folding should be kept in f16 until they reach the plugin
     if (is_keep_fp16_const(node))
         return false;
+    // Consts marked with keep_const_precision are decompressed by the plugin itself
+    if (is_keep_const_precision(node))
+        return false;
 
     auto from = node->get_element_type();
     auto it = precisions.find(from);
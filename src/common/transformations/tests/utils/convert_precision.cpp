@@ -24,6 +24,7 @@
 #include "ov_ops/type_relaxed.hpp"
 #include "transformations/common_optimizations/disable_shapeof_constant_folding.hpp"
 #include "transformations/rt_info/disable_fp16_compression.hpp"
+#include "transformations/rt_info/keep_const_precision.hpp"
 #include "transformations/utils/utils.hpp"
 
 using namespace testing;
@@ -1169,6 +1170,29 @@ void constant_convert_test(element::Type_t type_from, element::Type_t type_to, F
     ASSERT_EQ(expected, actual);
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset10::Constant::create(element::u4, Shape{2, 4}, {1, 2, 3, 4, 5, 6, 7, 8});
+        enable_keep_const_precision(weights);
+        auto convert = std::make_shared<opset10::Convert>(weights, element::f32);
+        auto matmul = std::make_shared<opset10::MatMul>(input, convert, false, true);
+
+        f = std::make_shared<Model>(NodeVector{matmul}, ParameterVector{input});
+
+        pass::Manager manager;
+
+        static const precisions_map precisions = {{element::u4, element::u8}};
+
+        manager.register_pass<pass::ConvertPrecision>(precisions);
+        manager.run_passes(f);
+    }
+
+    ASSERT_TRUE(has_type<element::Type_t::u4>(f));
+    ASSERT_FALSE(has_type<element::Type_t::u8>(f));
+}
+
 TEST(TransformationTests, ConvertPrecision_ConstantConversion_I64MinToI32) {
     constant_convert_test(element::Type_t::i64,
                           element::Type_t::i32,
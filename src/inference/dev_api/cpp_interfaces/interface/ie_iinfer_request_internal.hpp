@@ -13,6 +13,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 #include "ie_preprocess_data.hpp"
+#include "openvino/core/any.hpp"
 #include "openvino/core/node_output.hpp"
 #include "so_ptr.hpp"
 
@@ -73,6 +74,12 @@ public:
      */
     virtual void Cancel();
 
+    /**
+     * @brief Sets the properties of the following inferences of the request
+     * @param properties Map of pairs: (property name, property value)
+     */
+    virtual void SetProperties(const ov::AnyMap& properties);
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming layer.
      *  Note: not all plugins may provide meaningful data
@@ -82,12 +82,26 @@ INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(THREADS_PER_STREAM_SMALL);
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
 
 /**
- * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
- * stream
+ * @brief Defines how many records can be stored in the CPU runtime parameters cache, which is shared by all the streams
+ * and compiled models in the process
  * @ingroup ie_dev_api_plugin_api
  */
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines the budget in bytes of the CPU cache of the dynamic graph shape plans keyed by the input shapes,
+ * each stream keeps its own cache, zero disables the cache
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_DYNAMIC_PLAN_CACHE_CAPACITY);
+
+/**
+ * @brief Enables the process-wide CPU streams pool shared by the compiled models instead of the streams of each model,
+ * the streams are reassigned between the models according to their queue depths
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_POOL);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
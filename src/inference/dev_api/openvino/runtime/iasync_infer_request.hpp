@@ -9,8 +9,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
 #include <future>
 #include <memory>
+#include <mutex>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/exception.hpp"
@@ -71,6 +75,22 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets scheduling parameters of the following runs of the request. The stage tasks are run by the
+     * executors with the given priority, and with the deadline @p latency_budget after the start of the run
+     * @param priority - priority of the stage tasks
+     * @param latency_budget - time the run is expected to complete in, zero means no deadline
+     */
+    void set_priority(ov::hint::Priority priority,
+                      const std::chrono::microseconds& latency_budget = std::chrono::microseconds{0});
+
+    /**
+     * @brief Sets the properties of the following runs of the request. The default implementation accepts
+     * ov::hint::priority, which is passed to set_priority()
+     * @param properties Map of pairs: (property name, property value)
+     */
+    virtual void set_property(const ov::AnyMap& properties);
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -196,11 +216,28 @@ protected:
 
 private:
     enum InferState { IDLE, BUSY, CANCELLED, STOP };
-    using Futures = std::vector<std::shared_future<void>>;
     enum Stage_e : std::uint8_t { EXECUTOR, TASK };
     InferState m_state = InferState::IDLE;
-    Futures m_futures;
-    std::promise<void> m_promise;
+
+    // The runs of the pipeline are numbered and share the completion state below, which is reused by all the runs,
+    // so neither starting nor completing a run allocates memory. A waiter waits for the run which was the last one
+    // started when the wait began.
+    std::uint64_t m_started_runs = 0;   //!< Number of the last started run
+    std::uint64_t m_finished_runs = 0;  //!< Number of the last finished run
+    std::size_t m_running = 0;          //!< Started runs which haven't finished yet (including their callbacks)
+    std::uint64_t m_exception_run = 0;  //!< Number of the run which m_run_exception belongs to
+    std::exception_ptr m_run_exception;
+    std::condition_variable m_completion;
+
+    // The run in flight. The stage tasks refer to these members instead of capturing them, so a stage task holds just
+    // the request and the stage and fits into the small buffer of ov::threading::Task.
+    Pipeline::iterator m_run_end;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_run_callback_executor;
+    ov::threading::TaskPriority m_run_priority;
+    std::exception_ptr m_stage_exception;
+
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
+    std::chrono::microseconds m_latency_budget{0};
 
     friend struct DisableCallbackGuard;
     struct DisableCallbackGuard {
@@ -218,11 +255,26 @@ private:
 
     void run_first_stage(const Pipeline::iterator itBeginStage,
                          const Pipeline::iterator itEndStage,
-                         const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor = {});
+                         const std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor = {});
+
+    ov::threading::Task make_next_stage_task(const Pipeline::iterator itStage);
 
-    ov::threading::Task make_next_stage_task(const Pipeline::iterator itStage,
-                                             const Pipeline::iterator itEndStage,
-                                             const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor);
+    void run_task(ov::threading::ITaskExecutor& executor, ov::threading::Task task) const;
+
+    void run_stage(const Pipeline::iterator itStage);
+
+    /**
+     * @brief Runs the callback and completes the run, the last stage of the pipeline
+     */
+    void finish_run();
+
+    /**
+     * @brief Completes the run which failed to start, the callback is not called
+     */
+    void abort_run(std::exception_ptr exception);
+
+    // must be called under m_mutex
+    void complete_run(std::uint64_t run, const std::exception_ptr& exception);
 
     template <typename F>
     void infer_impl(const F& f) {
@@ -236,21 +288,10 @@ private:
                 ov::Busy::create("Infer Request is busy");
             case InferState::CANCELLED:
                 ov::Cancelled::create("Infer Request was canceled");
-            case InferState::IDLE: {
-                m_futures.erase(std::remove_if(std::begin(m_futures),
-                                               std::end(m_futures),
-                                               [](const std::shared_future<void>& future) {
-                                                   if (future.valid()) {
-                                                       return (std::future_status::ready ==
-                                                               future.wait_for(std::chrono::milliseconds{0}));
-                                                   } else {
-                                                       return true;
-                                                   }
-                                               }),
-                                m_futures.end());
-                m_promise = {};
-                m_futures.emplace_back(m_promise.get_future().share());
-            } break;
+            case InferState::IDLE:
+                ++m_started_runs;
+                ++m_running;
+                break;
             case InferState::STOP:
                 break;
             }
@@ -260,9 +301,7 @@ private:
             try {
                 f();
             } catch (...) {
-                m_promise.set_exception(std::current_exception());
-                std::lock_guard<std::mutex> lock{m_mutex};
-                m_state = InferState::IDLE;
+                abort_run(std::current_exception());
                 throw;
             }
         }
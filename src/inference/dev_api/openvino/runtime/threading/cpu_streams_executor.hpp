@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -23,10 +25,22 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the per-thread queues, the tasks are dispatched
+ *        in the submission order.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
+    /**
+     * @brief Queue statistics of the tasks of one priority
+     */
+    struct QueueStatistics {
+        ov::hint::Priority priority;               //!< Priority of the tasks
+        size_t depth = 0;                          //!< Number of the tasks waiting in the queue
+        size_t dispatched = 0;                     //!< Number of the tasks taken from the queue by the streams
+        std::chrono::microseconds total_delay{0};  //!< Sum of the times the dispatched tasks have waited in the queue
+        std::chrono::microseconds max_delay{0};    //!< Longest time a dispatched task has waited in the queue
+    };
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -40,8 +54,24 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Runs the tasks of a higher priority first, the tasks of the same priority in the order of their deadlines.
+     *        A task of a lower priority is run after a bounded number of tasks of higher priorities, so it is not
+     *        starved. The tasks passed to run() have the default priority and no deadline.
+     * @param task A task to start
+     * @param priority Scheduling parameters of the task
+     */
+    void run_with_priority(Task task, const TaskPriority& priority) override;
+
     void execute(Task task) override;
 
+    /**
+     * @brief Returns the queue statistics per priority, from the highest priority to the lowest one.
+     * @note The delays are measured for the tasks passed to run_with_priority() only
+     * @return Vector of the statistics
+     */
+    std::vector<QueueStatistics> get_queue_statistics() const;
+
     int get_stream_id() override;
 
     int get_numa_node_id() override;
@@ -9,11 +9,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
 
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace threading {
@@ -25,6 +27,30 @@ namespace threading {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling parameters of a task
+ * @ingroup ov_dev_api_threading
+ */
+struct TaskPriority {
+    using Clock = std::chrono::steady_clock;
+
+    TaskPriority() = default;
+    TaskPriority(ov::hint::Priority priority, Clock::time_point deadline = Clock::time_point::max())
+        : priority(priority),
+          deadline(deadline) {}
+
+    ov::hint::Priority priority = ov::hint::Priority::DEFAULT;  //!< The tasks of a higher priority are run first
+    Clock::time_point deadline = Clock::time_point::max();     //!< Among equal priorities the earliest deadline is first
+
+    /**
+     * @brief Checks whether the task has no scheduling requirements, so it can be run as any other task
+     * @return true if the priority is default and there is no deadline
+     */
+    bool is_default() const {
+        return priority == ov::hint::Priority::DEFAULT && deadline == Clock::time_point::max();
+    }
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ov_dev_api_threading
@@ -57,6 +83,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute ov::Task inside task executor context taking its priority and deadline into account.
+     *        Default implementation ignores the scheduling parameters and uses run() pure virtual method
+     * @param task A task to start
+     * @param priority Scheduling parameters of the task
+     */
+    virtual void run_with_priority(Task task, const TaskPriority& priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default run_and_wait() method implementation uses run() pure virtual method
@@ -11,7 +11,6 @@
 
 #include <memory>
 #include <string>
-
 #include "threading/ie_istreams_executor.hpp"
 
 namespace InferenceEngine {
@@ -42,6 +41,10 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, const ov::threading::TaskPriority& priority) override;
+
+    std::vector<ov::threading::CPUStreamsExecutor::QueueStatistics> GetQueueStatistics() const override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "ie_parameter.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
 
@@ -142,6 +143,13 @@ public:
      */
     virtual void Execute(Task task) = 0;
 
+    /**
+     * @brief Returns the statistics of the task queues per priority, see
+     * ov::threading::CPUStreamsExecutor::get_queue_statistics
+     * @return Vector of the statistics, empty if the executor does not track its queues
+     */
+    virtual std::vector<ov::threading::CPUStreamsExecutor::QueueStatistics> GetQueueStatistics() const;
+
     int get_stream_id() override {
         return GetStreamId();
     }
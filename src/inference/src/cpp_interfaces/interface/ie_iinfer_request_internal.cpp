@@ -89,6 +89,10 @@ void IInferRequestInternal::Cancel() {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetProperties(const ov::AnyMap&) {
+    IE_THROW(NotImplemented);
+}
+
 std::map<std::string, InferenceEngineProfileInfo> IInferRequestInternal::GetPerformanceCounts() const {
     IE_THROW(NotImplemented);
 }
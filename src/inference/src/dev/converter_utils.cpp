@@ -511,6 +511,10 @@ public:
         m_request->cancel();
     }
 
+    void SetProperties(const ov::AnyMap& properties) override {
+        m_request->set_property(properties);
+    }
+
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override {
         auto res = m_request->get_profiling_info();
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> ret;
@@ -725,6 +729,10 @@ public:
         m_request->Cancel();
     }
 
+    void set_property(const ov::AnyMap& properties) override {
+        m_request->SetProperties(properties);
+    }
+
     std::vector<ov::ProfilingInfo> get_profiling_info() const override {
         auto ieInfos = m_request->GetPerformanceCounts();
         std::vector<ov::ProfilingInfo> infos;
@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "openvino/runtime/isync_infer_request.hpp"
@@ -52,42 +53,40 @@ ov::IAsyncInferRequest::IAsyncInferRequest(const std::shared_ptr<IInferRequest>&
 }
 
 void ov::IAsyncInferRequest::wait() {
-    // Just use the last '_futures' member to wait pipeline completion
-    auto future = [&] {
-        std::lock_guard<std::mutex> lock{m_mutex};
-        return m_futures.empty() ? std::shared_future<void>{} : m_futures.back();
-    }();
-
-    if (!future.valid()) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    // Just wait for the completion of the last started run
+    const auto run = m_started_runs;
+    if (run == 0) {
         return;
     }
 
-    future.wait();
-    future.get();
+    m_completion.wait(lock, [&] {
+        return m_finished_runs >= run;
+    });
+    if (m_exception_run == run && m_run_exception) {
+        std::rethrow_exception(m_run_exception);
+    }
 }
 
 bool ov::IAsyncInferRequest::wait_for(const std::chrono::milliseconds& timeout) {
     OPENVINO_ASSERT(timeout >= std::chrono::milliseconds{0}, "Timeout can't be less than 0 for InferRequest::wait().");
-    auto status = std::future_status::deferred;
 
-    // Just use the last '_futures' member to wait pipeline completion
-    auto future = [&] {
-        std::lock_guard<std::mutex> lock{m_mutex};
-        return m_futures.empty() ? std::shared_future<void>{} : m_futures.back();
-    }();
-
-    if (!future.valid()) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    // Just wait for the completion of the last started run
+    const auto run = m_started_runs;
+    if (run == 0) {
         return false;
     }
 
-    status = future.wait_for(std::chrono::milliseconds{timeout});
-
-    if (std::future_status::ready == status) {
-        future.get();
-        return true;
-    } else {
+    if (!m_completion.wait_for(lock, timeout, [&] {
+            return m_finished_runs >= run;
+        })) {
         return false;
     }
+    if (m_exception_run == run && m_run_exception) {
+        std::rethrow_exception(m_run_exception);
+    }
+    return true;
 }
 
 void ov::IAsyncInferRequest::cancel() {
@@ -102,6 +101,24 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::move(callback);
 }
 
+void ov::IAsyncInferRequest::set_priority(ov::hint::Priority priority,
+                                          const std::chrono::microseconds& latency_budget) {
+    OPENVINO_ASSERT(latency_budget >= std::chrono::microseconds{0}, "Latency budget can't be less than 0");
+    check_state();
+    m_priority = priority;
+    m_latency_budget = latency_budget;
+}
+
+void ov::IAsyncInferRequest::set_property(const ov::AnyMap& properties) {
+    for (const auto& property : properties) {
+        if (property.first == ov::hint::priority.name()) {
+            set_priority(property.second.as<ov::hint::Priority>(), m_latency_budget);
+        } else {
+            OPENVINO_THROW("Unsupported infer request property: ", property.first);
+        }
+    }
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -117,70 +134,113 @@ void ov::IAsyncInferRequest::start_async_thread_unsafe() {
 
 void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginStage,
                                              const Pipeline::iterator itEndStage,
-                                             const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
+                                             const std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) {
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
-}
-
-ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
-    const Pipeline::iterator itStage,
-    const Pipeline::iterator itEndStage,
-    const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
-    return std::bind(
-        [this, itStage, itEndStage](std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) mutable {
-            std::exception_ptr currentException = nullptr;
-            auto& thisStage = *itStage;
-            auto itNextStage = itStage + 1;
-            try {
-                auto& stageTask = std::get<Stage_e::TASK>(thisStage);
-                OPENVINO_ASSERT(nullptr != stageTask);
-                stageTask();
-                if (itEndStage != itNextStage) {
-                    auto& nextStage = *itNextStage;
-                    auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
-                    OPENVINO_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)));
-                }
-            } catch (...) {
-                currentException = std::current_exception();
-            }
-
-            if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                auto lastStageTask = [this, currentException]() mutable {
-                    auto promise = std::move(m_promise);
-                    std::function<void(std::exception_ptr)> callback;
-                    {
-                        std::lock_guard<std::mutex> lock{m_mutex};
-                        m_state = InferState::IDLE;
-                        std::swap(callback, m_callback);
-                    }
-                    if (callback) {
-                        try {
-                            callback(currentException);
-                        } catch (...) {
-                            currentException = std::current_exception();
-                        }
-                        std::lock_guard<std::mutex> lock{m_mutex};
-                        if (!m_callback) {
-                            std::swap(callback, m_callback);
-                        }
-                    }
-                    if (nullptr == currentException) {
-                        promise.set_value();
-                    } else {
-                        promise.set_exception(currentException);
-                    }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
-                } else {
-                    callbackExecutor->run(std::move(lastStageTask));
-                }
-            }
-        },
-        std::move(callbackExecutor));
+    m_run_end = itEndStage;
+    m_run_callback_executor = callbackExecutor;
+    m_run_priority.priority = m_priority;
+    m_run_priority.deadline = m_latency_budget.count() == 0
+                                  ? ov::threading::TaskPriority::Clock::time_point::max()
+                                  : ov::threading::TaskPriority::Clock::now() + m_latency_budget;
+    run_task(*firstStageExecutor, make_next_stage_task(itBeginStage));
+}
+
+void ov::IAsyncInferRequest::run_task(ov::threading::ITaskExecutor& executor, ov::threading::Task task) const {
+    // copied as the run may complete and the next one may start before the executor returns
+    const auto priority = m_run_priority;
+    if (priority.is_default()) {
+        executor.run(std::move(task));
+    } else {
+        executor.run_with_priority(std::move(task), priority);
+    }
+}
+
+ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(const Pipeline::iterator itStage) {
+    return [this, itStage] {
+        run_stage(itStage);
+    };
+}
+
+void ov::IAsyncInferRequest::run_stage(const Pipeline::iterator itStage) {
+    std::exception_ptr currentException = nullptr;
+    auto itNextStage = itStage + 1;
+    // once the next stage is scheduled the run may complete and the next run may start at any moment,
+    // so the members of the run are not accessed after that
+    const bool isLastStage = m_run_end == itNextStage;
+    try {
+        auto& stageTask = std::get<Stage_e::TASK>(*itStage);
+        OPENVINO_ASSERT(nullptr != stageTask);
+        stageTask();
+        if (!isLastStage) {
+            auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(*itNextStage);
+            OPENVINO_ASSERT(nullptr != nextStageExecutor);
+            run_task(*nextStageExecutor, make_next_stage_task(itNextStage));
+        }
+    } catch (...) {
+        currentException = std::current_exception();
+    }
+
+    if (isLastStage || (nullptr != currentException)) {
+        m_stage_exception = std::move(currentException);
+        // the callback executor is kept alive until it returns, the request may be released by the callback
+        auto callbackExecutor = m_run_callback_executor;
+        if (nullptr == callbackExecutor) {
+            finish_run();
+        } else {
+            run_task(*callbackExecutor, [this] {
+                finish_run();
+            });
+        }
+    }
+}
+
+void ov::IAsyncInferRequest::finish_run() {
+    std::exception_ptr currentException;
+    std::function<void(std::exception_ptr)> callback;
+    std::uint64_t run = 0;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        std::swap(currentException, m_stage_exception);
+        run = m_started_runs;
+        if (m_state != InferState::STOP) {
+            m_state = InferState::IDLE;
+        }
+        std::swap(callback, m_callback);
+        if (!callback) {
+            complete_run(run, currentException);
+            return;
+        }
+    }
+
+    // the callback may start the next run of the request
+    try {
+        callback(currentException);
+    } catch (...) {
+        currentException = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (!m_callback && m_state != InferState::STOP) {
+        std::swap(callback, m_callback);
+    }
+    complete_run(run, currentException);
+}
+
+void ov::IAsyncInferRequest::abort_run(std::exception_ptr exception) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_state = InferState::IDLE;
+    complete_run(m_started_runs, exception);
+}
+
+void ov::IAsyncInferRequest::complete_run(std::uint64_t run, const std::exception_ptr& exception) {
+    m_finished_runs = std::max(m_finished_runs, run);
+    if (nullptr != exception) {
+        m_run_exception = exception;
+        m_exception_run = run;
+    }
+    --m_running;
+    // notified under the lock, the request may be destroyed as soon as the lock is released
+    m_completion.notify_all();
 }
 
 void ov::IAsyncInferRequest::start_async() {
@@ -234,23 +294,13 @@ void ov::IAsyncInferRequest::set_tensors(const ov::Output<const ov::Node>& port,
 }
 
 void ov::IAsyncInferRequest::stop_and_wait() {
-    Futures futures;
-    InferState state = InferState::IDLE;
-    {
-        std::lock_guard<std::mutex> lock{m_mutex};
-        state = m_state;
-        if (state != InferState::STOP) {
-            m_callback = {};
-            m_state = InferState::STOP;
-            futures = std::move(m_futures);
-        }
-    }
-    if (state != InferState::STOP) {
-        for (auto&& future : futures) {
-            if (future.valid()) {
-                future.wait();
-            }
-        }
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_state != InferState::STOP) {
+        m_callback = {};
+        m_state = InferState::STOP;
+        m_completion.wait(lock, [&] {
+            return m_running == 0;
+        });
     }
 }
 
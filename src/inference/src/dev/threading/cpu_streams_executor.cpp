@@ -4,7 +4,12 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -14,16 +19,151 @@
 
 #include "dev/threading/parallel_custom_arena.hpp"
 #include "dev/threading/thread_affinity.hpp"
+#include "openvino/core/except.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor_internal.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/thread_local.hpp"
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
 
 namespace ov {
 namespace threading {
 // maybe there are two CPUStreamsExecutors in the same thread.
 thread_local std::map<void*, std::shared_ptr<std::thread::id>> t_stream_count_map;
+
+namespace {
+// each worker thread has its own queue, the tasks are distributed among them in the round-robin fashion
+constexpr size_t workerQueueCapacity = 256;
+// the number of attempts to find a task before a worker thread parks
+constexpr int minSpins = 16;
+constexpr int maxSpins = 1024;
+// the tasks passed to run_with_priority() are queued per priority: HIGH, MEDIUM (the tasks passed to run()) and LOW
+constexpr size_t priorityLevels = 3;
+constexpr size_t defaultPriorityLevel = 1;
+// the number of tasks of higher priorities dispatched while a task of a lower priority waits before it is run anyway
+constexpr size_t starvationLimit = 16;
+
+size_t priority_level(ov::hint::Priority priority) {
+    switch (priority) {
+    case ov::hint::Priority::HIGH:
+        return 0;
+    case ov::hint::Priority::LOW:
+        return 2;
+    default:
+        return defaultPriorityLevel;
+    }
+}
+
+ov::hint::Priority level_priority(size_t level) {
+    const ov::hint::Priority priorities[priorityLevels] = {ov::hint::Priority::HIGH,
+                                                           ov::hint::Priority::MEDIUM,
+                                                           ov::hint::Priority::LOW};
+    return priorities[level];
+}
+
+struct PrioritizedTask {
+    Task _task;
+    TaskPriority::Clock::time_point _deadline;
+    TaskPriority::Clock::time_point _enqueued;
+    uint64_t _sequence;
+
+    // ThreadSafeBoundedPriorityQueue pops the smallest task first: the earliest deadline, then the earliest submitted
+    bool operator>(const PrioritizedTask& other) const {
+        if (_deadline != other._deadline) {
+            return _deadline > other._deadline;
+        }
+        return _sequence > other._sequence;
+    }
+};
+
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue (D. Vyukov's algorithm).
+ * Each cell has a sequence number telling whether the cell is ready to be written or read at the given position,
+ * so the producers and the consumers only contend on the position counters.
+ * Each value is pushed with its order (the submission number of the task), the order of the first value can be read
+ * without popping it, so the consumer of several queues pops the oldest value.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : _buffer(new Cell[capacity]), _mask(capacity - 1) {
+        OPENVINO_ASSERT(capacity >= 2 && (capacity & (capacity - 1)) == 0, "Queue capacity must be a power of two");
+        for (size_t i = 0; i < capacity; ++i) {
+            _buffer[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // the value is moved from only if it has been pushed
+    bool push(T& value, uint64_t order) {
+        Cell* cell;
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_buffer[pos & _mask];
+            const size_t seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_order.store(order, std::memory_order_relaxed);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // the order of the first value, if any; the value may be popped by another consumer right after the call
+    bool front(uint64_t& order) const {
+        const size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        const Cell& cell = _buffer[pos & _mask];
+        if (cell._sequence.load(std::memory_order_acquire) != pos + 1)
+            return false;
+        order = cell._order.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    bool pop(T& value) {
+        Cell* cell;
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_buffer[pos & _mask];
+            const size_t seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        // release the resources captured by the task right away
+        cell->_value = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> _sequence;
+        std::atomic<uint64_t> _order{0};
+        T _value;
+    };
+
+    std::unique_ptr<Cell[]> _buffer;
+    const size_t _mask;
+    std::atomic<size_t> _enqueuePos{0};
+    std::atomic<size_t> _dequeuePos{0};
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -432,36 +572,229 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        InitTaskQueues();
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                int spinBudget = minSpins;
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    if (!WaitForTask(streamId, task, spinBudget)) {
+                        break;
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
         _streams.set_thread_ids_map(_threads);
     }
 
+    void InitTaskQueues() {
+        const auto streams = static_cast<size_t>(_config._streams);
+        for (size_t i = 0; i < streams; ++i) {
+            _workerQueues.emplace_back(new BoundedQueue<Task>(workerQueueCapacity));
+        }
+        // the same NUMA node mapping as the one of the streams created by the worker threads
+        auto numaNodeOf = [&](size_t worker) {
+            if (_usedNumaNodes.empty())
+                return 0;
+            const auto streamsPerNode = (streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size();
+            return _usedNumaNodes.at(worker / streamsPerNode);
+        };
+        _stealOrder.resize(streams);
+        for (size_t worker = 0; worker < streams; ++worker) {
+            std::vector<size_t> otherNodes;
+            for (size_t i = 1; i < streams; ++i) {
+                const auto victim = (worker + i) % streams;
+                if (numaNodeOf(victim) == numaNodeOf(worker)) {
+                    _stealOrder[worker].push_back(victim);
+                } else {
+                    otherNodes.push_back(victim);
+                }
+            }
+            // the queues of the other NUMA nodes are the last resort, so no task waits for busy streams of its node
+            // while there are idle ones
+            _stealOrder[worker].insert(_stealOrder[worker].end(), otherNodes.begin(), otherNodes.end());
+        }
+        for (auto& queue : _priorityQueues) {
+            queue._tasks.set_capacity(std::numeric_limits<size_t>::max());
+        }
+    }
+
+    bool TryPop(int worker, Task& task) {
+        const bool found = _prioritizedTasks.load(std::memory_order_acquire) > 0 ? TryPopPrioritized(worker, task)
+                                                                                  : TryPopDefault(worker, task);
+        if (found) {
+            _pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return found;
+    }
+
+    // the tasks are dispatched in the submission order: the oldest task at the heads of the worker queues is popped,
+    // the own queue and the queues of the same NUMA node win the ties (which are possible only for the tasks
+    // submitted while the queue of the next worker was full)
+    bool TryPopDefault(int worker, Task& task) {
+        bool found = false;
+        for (;;) {
+            size_t oldest = _workerQueues.size();
+            uint64_t oldestOrder = std::numeric_limits<uint64_t>::max();
+            uint64_t order = 0;
+            if (_workerQueues[worker]->front(order)) {
+                oldest = static_cast<size_t>(worker);
+                oldestOrder = order;
+            }
+            for (const auto victim : _stealOrder[worker]) {
+                if (_workerQueues[victim]->front(order) && order < oldestOrder) {
+                    oldest = victim;
+                    oldestOrder = order;
+                }
+            }
+            if (oldest == _workerQueues.size())
+                break;
+            // another worker may have popped the task, the heads are checked again then
+            if (_workerQueues[oldest]->pop(task)) {
+                found = true;
+                break;
+            }
+        }
+        if (!found && _overflowSize.load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowSize.fetch_sub(1, std::memory_order_relaxed);
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    // the levels are visited from the highest priority, but a level starved by the higher ones is visited first
+    bool TryPopPrioritized(int worker, Task& task) {
+        size_t starved = priorityLevels;
+        for (size_t level = priorityLevels - 1; level > 0 && starved == priorityLevels; --level) {
+            if (_priorityQueues[level]._skipped.load(std::memory_order_relaxed) >= starvationLimit) {
+                starved = level;
+            }
+        }
+        if (starved != priorityLevels && TryPopLevel(starved, worker, task)) {
+            return true;
+        }
+        for (size_t level = 0; level < priorityLevels; ++level) {
+            if (level != starved && TryPopLevel(level, worker, task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TryPopLevel(size_t level, int worker, Task& task) {
+        auto& queue = _priorityQueues[level];
+        PrioritizedTask prioritized;
+        bool found = false;
+        if (queue._depth.load(std::memory_order_acquire) > 0 && queue._tasks.try_pop(prioritized)) {
+            const auto delay = std::chrono::duration_cast<std::chrono::microseconds>(TaskPriority::Clock::now() -
+                                                                                      prioritized._enqueued)
+                                   .count();
+            queue._totalDelay.fetch_add(delay, std::memory_order_relaxed);
+            auto maxDelay = queue._maxDelay.load(std::memory_order_relaxed);
+            while (delay > maxDelay &&
+                   !queue._maxDelay.compare_exchange_weak(maxDelay, delay, std::memory_order_relaxed)) {
+            }
+            queue._dispatched.fetch_add(1, std::memory_order_relaxed);
+            queue._depth.fetch_sub(1, std::memory_order_relaxed);
+            _prioritizedTasks.fetch_sub(1, std::memory_order_relaxed);
+            task = std::move(prioritized._task);
+            found = true;
+        } else if (level == defaultPriorityLevel) {
+            found = TryPopDefault(worker, task);
+        }
+        if (found) {
+            // the waiting tasks of the lower priorities are one step closer to be run anyway
+            queue._skipped.store(0, std::memory_order_relaxed);
+            for (size_t lower = level + 1; lower < priorityLevels; ++lower) {
+                if (Depth(lower) > 0) {
+                    _priorityQueues[lower]._skipped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        return found;
+    }
+
+    int64_t Depth(size_t level) const {
+        auto depth = _priorityQueues[level]._depth.load(std::memory_order_relaxed);
+        if (level == defaultPriorityLevel) {
+            depth += _pendingTasks.load(std::memory_order_relaxed) - _prioritizedTasks.load(std::memory_order_relaxed);
+        }
+        return std::max<int64_t>(depth, 0);
+    }
+
+    // spins for a while (the budget adapts to whether spinning pays off), then parks on the condition variable
+    bool WaitForTask(int worker, Task& task, int& spinBudget) {
+        for (;;) {
+            if (TryPop(worker, task)) {
+                return true;
+            }
+            for (int spin = 0; spin < spinBudget; ++spin) {
+                if (_pendingTasks.load(std::memory_order_acquire) > 0 && TryPop(worker, task)) {
+                    spinBudget = std::min(spinBudget * 2, maxSpins);
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+            spinBudget = std::max(spinBudget / 2, minSpins);
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _sleepingWorkers.fetch_add(1);
+            _queueCondVar.wait(lock, [&] {
+                return _pendingTasks.load() > 0 || _isStopped;
+            });
+            _sleepingWorkers.fetch_sub(1);
+            // the tasks enqueued before the stop are still executed
+            if (_isStopped && _pendingTasks.load() == 0) {
+                return false;
+            }
+        }
+    }
+
     void Enqueue(Task task) {
-        {
+        const auto workers = _workerQueues.size();
+        // the submission number is both the order of the task and the round-robin position of its queue
+        const auto order = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        // while the overflow queue is not empty the new tasks go there as well to keep the order of the tasks
+        bool pushed = false;
+        for (size_t i = 0; !pushed && _overflowSize.load(std::memory_order_acquire) == 0 && i < workers; ++i) {
+            pushed = _workerQueues[(order + i) % workers]->push(task, order);
+        }
+        if (!pushed) {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+        // the counter is published after the task, so a woken up worker always finds it; a worker that has seen
+        // no pending tasks before parking is guaranteed to be seen as sleeping here
+        _pendingTasks.fetch_add(1);
+        WakeUpWorker();
+    }
+
+    void EnqueuePrioritized(Task task, const TaskPriority& priority) {
+        auto& queue = _priorityQueues[priority_level(priority.priority)];
+        queue._tasks.try_push(PrioritizedTask{std::move(task),
+                                              priority.deadline,
+                                              TaskPriority::Clock::now(),
+                                              _taskSequence.fetch_add(1, std::memory_order_relaxed)});
+        // the counters are published after the task the same way as in Enqueue()
+        queue._depth.fetch_add(1);
+        _prioritizedTasks.fetch_add(1, std::memory_order_release);
+        _pendingTasks.fetch_add(1);
+        WakeUpWorker();
+    }
+
+    void WakeUpWorker() {
+        if (_sleepingWorkers.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -498,9 +831,26 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<BoundedQueue<Task>>> _workerQueues;
+    std::vector<std::vector<size_t>> _stealOrder;
+    std::atomic<uint64_t> _nextQueue{0};  // submission number of the next task
+    std::atomic<int64_t> _pendingTasks{0};
+    std::atomic<int> _sleepingWorkers{0};
+    std::atomic<size_t> _overflowSize{0};
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::queue<Task> _taskQueue;  // overflow of the worker queues
+    struct PriorityQueue {
+        ThreadSafeBoundedPriorityQueue<PrioritizedTask> _tasks;
+        std::atomic<int64_t> _depth{0};
+        std::atomic<size_t> _skipped{0};  // tasks of higher priorities dispatched while this level was waiting
+        std::atomic<size_t> _dispatched{0};
+        std::atomic<int64_t> _totalDelay{0};  // microseconds
+        std::atomic<int64_t> _maxDelay{0};
+    };
+    std::array<PriorityQueue, priorityLevels> _priorityQueues;
+    std::atomic<int64_t> _prioritizedTasks{0};
+    std::atomic<uint64_t> _taskSequence{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -558,5 +908,29 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_with_priority(Task task, const TaskPriority& priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else if (priority.is_default()) {
+        _impl->Enqueue(std::move(task));
+    } else {
+        _impl->EnqueuePrioritized(std::move(task), priority);
+    }
+}
+
+std::vector<CPUStreamsExecutor::QueueStatistics> CPUStreamsExecutor::get_queue_statistics() const {
+    std::vector<QueueStatistics> statistics(priorityLevels);
+    for (size_t level = 0; level < priorityLevels; ++level) {
+        const auto& queue = _impl->_priorityQueues[level];
+        auto& levelStatistics = statistics[level];
+        levelStatistics.priority = level_priority(level);
+        levelStatistics.depth = static_cast<size_t>(_impl->Depth(level));
+        levelStatistics.dispatched = queue._dispatched.load(std::memory_order_relaxed);
+        levelStatistics.total_delay = std::chrono::microseconds{queue._totalDelay.load(std::memory_order_relaxed)};
+        levelStatistics.max_delay = std::chrono::microseconds{queue._maxDelay.load(std::memory_order_relaxed)};
+    }
+    return statistics;
+}
+
 }  // namespace threading
 }  // namespace ov
@@ -55,4 +55,12 @@ void CPUStreamsExecutor::run(Task task) {
     _impl->run(std::move(task));
 }
 
+void CPUStreamsExecutor::run_with_priority(Task task, const ov::threading::TaskPriority& priority) {
+    _impl->run_with_priority(std::move(task), priority);
+}
+
+std::vector<ov::threading::CPUStreamsExecutor::QueueStatistics> CPUStreamsExecutor::GetQueueStatistics() const {
+    return _impl->get_queue_statistics();
+}
+
 }  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 
 #include "ie_parallel.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
@@ -53,6 +54,10 @@ public:
         m_executor->run(task);
     }
 
+    void run_with_priority(Task task, const ov::threading::TaskPriority& priority) override {
+        m_executor->run_with_priority(std::move(task), priority);
+    }
+
     void runAndWait(const std::vector<Task>& tasks) override {
         m_executor->run_and_wait(tasks);
     }
@@ -67,9 +72,19 @@ public:
         m_executor->run(task);
     }
 
+    void run_with_priority(Task task, const ov::threading::TaskPriority& priority) override {
+        m_executor->run_with_priority(std::move(task), priority);
+    }
+
     void runAndWait(const std::vector<Task>& tasks) override {
         m_executor->run_and_wait(tasks);
     }
+
+    std::vector<ov::threading::CPUStreamsExecutor::QueueStatistics> GetQueueStatistics() const override {
+        auto executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_executor);
+        return executor ? executor->get_queue_statistics() : IStreamsExecutor::GetQueueStatistics();
+    }
+
     int GetStreamId() override {
         return m_executor->get_stream_id();
     }
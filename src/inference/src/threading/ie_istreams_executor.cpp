@@ -22,6 +22,10 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+std::vector<ov::threading::CPUStreamsExecutor::QueueStatistics> IStreamsExecutor::GetQueueStatistics() const {
+    return {};
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
     return get_property(ov::supported_properties.name()).as<std::vector<std::string>>();
 }
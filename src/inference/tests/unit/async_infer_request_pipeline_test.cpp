@@ -0,0 +1,220 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/node_output.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+// Copies the input to the output, so the measured time is dominated by the pipeline overhead
+class IdentityInferRequest : public ov::IInferRequest {
+public:
+    explicit IdentityInferRequest(size_t size) : m_input(size, 1.f), m_output(size) {}
+
+    void infer() override {
+        std::copy(m_input.begin(), m_input.end(), m_output.begin());
+    }
+    std::vector<ov::ProfilingInfo> get_profiling_info() const override {
+        return {};
+    }
+    ov::SoPtr<ov::ITensor> get_tensor(const ov::Output<const ov::Node>&) const override {
+        return {};
+    }
+    void set_tensor(const ov::Output<const ov::Node>&, const ov::SoPtr<ov::ITensor>&) override {}
+    std::vector<ov::SoPtr<ov::ITensor>> get_tensors(const ov::Output<const ov::Node>&) const override {
+        return {};
+    }
+    void set_tensors(const ov::Output<const ov::Node>&, const std::vector<ov::SoPtr<ov::ITensor>>&) override {}
+    std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override {
+        return {};
+    }
+    const std::shared_ptr<const ov::ICompiledModel>& get_compiled_model() const override {
+        return m_compiled_model;
+    }
+    const std::vector<ov::Output<const ov::Node>>& get_inputs() const override {
+        return m_ports;
+    }
+    const std::vector<ov::Output<const ov::Node>>& get_outputs() const override {
+        return m_ports;
+    }
+    void check_tensors() const override {}
+
+private:
+    std::vector<float> m_input;
+    std::vector<float> m_output;
+    std::shared_ptr<const ov::ICompiledModel> m_compiled_model;
+    std::vector<ov::Output<const ov::Node>> m_ports;
+};
+
+class AsyncInferRequest : public ov::IAsyncInferRequest {
+public:
+    AsyncInferRequest(const std::shared_ptr<ov::IInferRequest>& request,
+                      const std::shared_ptr<ITaskExecutor>& task_executor)
+        : ov::IAsyncInferRequest(request, task_executor, nullptr) {}
+    ~AsyncInferRequest() {
+        stop_and_wait();
+    }
+};
+
+// The former pipeline: a promise and a shared future per run, the stage tasks are chained through std::bind
+class PromiseChainedInferRequest {
+public:
+    PromiseChainedInferRequest(const std::shared_ptr<ov::IInferRequest>& request,
+                               const std::shared_ptr<ITaskExecutor>& task_executor)
+        : m_request(request) {
+        m_pipeline = {{task_executor, [this] {
+                           m_request->infer();
+                       }}};
+    }
+    ~PromiseChainedInferRequest() {
+        wait();
+    }
+
+    void set_callback(std::function<void(std::exception_ptr)> callback) {
+        m_callback = std::move(callback);
+    }
+
+    void start_async() {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_futures.erase(std::remove_if(m_futures.begin(),
+                                           m_futures.end(),
+                                           [](const std::shared_future<void>& future) {
+                                               return std::future_status::ready ==
+                                                      future.wait_for(std::chrono::milliseconds{0});
+                                           }),
+                            m_futures.end());
+            m_promise = {};
+            m_futures.emplace_back(m_promise.get_future().share());
+        }
+        m_pipeline.front().first->run(make_next_stage_task(m_pipeline.begin(), std::shared_ptr<ITaskExecutor>{}));
+    }
+
+    void wait() {
+        auto future = [&] {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            return m_futures.empty() ? std::shared_future<void>{} : m_futures.back();
+        }();
+        if (future.valid())
+            future.wait();
+    }
+
+private:
+    using Pipeline = std::vector<std::pair<std::shared_ptr<ITaskExecutor>, Task>>;
+
+    Task make_next_stage_task(Pipeline::iterator itStage, std::shared_ptr<ITaskExecutor> callbackExecutor) {
+        return std::bind(
+            [this, itStage](std::shared_ptr<ITaskExecutor>& callbackExecutor) {
+                itStage->second();
+                auto itNextStage = itStage + 1;
+                if (itNextStage != m_pipeline.end()) {
+                    itNextStage->first->run(make_next_stage_task(itNextStage, std::move(callbackExecutor)));
+                    return;
+                }
+                auto promise = std::move(m_promise);
+                std::function<void(std::exception_ptr)> callback;
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    std::swap(callback, m_callback);
+                }
+                callback(nullptr);
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    if (!m_callback)
+                        std::swap(callback, m_callback);
+                }
+                promise.set_value();
+            },
+            std::move(callbackExecutor));
+    }
+
+    std::shared_ptr<ov::IInferRequest> m_request;
+    Pipeline m_pipeline;
+    std::mutex m_mutex;
+    std::promise<void> m_promise;
+    std::vector<std::shared_future<void>> m_futures;
+    std::function<void(std::exception_ptr)> m_callback;
+};
+
+// Runs the requests back to back from their callbacks, returns the number of requests per second
+template <typename Request>
+double run_chained(Request& request, size_t iterations) {
+    std::atomic<size_t> completed{0};
+    std::promise<void> done;
+    request.set_callback([&](std::exception_ptr exception) {
+        ASSERT_EQ(exception, nullptr);
+        if (++completed == iterations) {
+            done.set_value();
+        } else {
+            request.start_async();
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    request.start_async();
+    done.get_future().wait();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    request.wait();
+    EXPECT_EQ(completed.load(), iterations);
+    return iterations / elapsed.count();
+}
+
+}  // namespace
+
+TEST(AsyncInferRequestPipelineTest, ReusedCompletionMatchesPromiseChainedPipeline) {
+    constexpr size_t iterations = 20000;
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"AsyncInferRequestPipelineTest"});
+    auto identity = std::make_shared<IdentityInferRequest>(16);
+
+    double promiseChained = 0, reusedCompletion = 0;
+    {
+        PromiseChainedInferRequest request(identity, executor);
+        promiseChained = run_chained(request, iterations);
+    }
+    {
+        AsyncInferRequest request(identity, executor);
+        reusedCompletion = run_chained(request, iterations);
+    }
+    std::cout << "[ REQ/SEC  ] promise chained: " << promiseChained << ", reused completion: " << reusedCompletion
+              << std::endl;
+}
+
+TEST(AsyncInferRequestPipelineTest, WaitRethrowsTheExceptionOfTheLastRun) {
+    class ThrowingInferRequest : public IdentityInferRequest {
+    public:
+        ThrowingInferRequest() : IdentityInferRequest(1) {}
+        void infer() override {
+            if (m_throw)
+                OPENVINO_THROW("infer failed");
+        }
+        bool m_throw = true;
+    };
+
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"AsyncInferRequestPipelineTest"});
+    auto throwing = std::make_shared<ThrowingInferRequest>();
+    AsyncInferRequest request(throwing, executor);
+
+    request.start_async();
+    ASSERT_THROW(request.wait(), ov::Exception);
+    ASSERT_THROW(request.wait(), ov::Exception);
+
+    throwing->m_throw = false;
+    request.start_async();
+    ASSERT_NO_THROW(request.wait());
+    ASSERT_TRUE(request.wait_for(std::chrono::milliseconds{0}));
+}
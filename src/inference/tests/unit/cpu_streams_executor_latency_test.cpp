@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+class CPUStreamsExecutorLatencyTest : public ::testing::TestWithParam<size_t> {};
+
+// Measures the time between the task submission and the start of its execution with the given number of producers
+TEST_P(CPUStreamsExecutorLatencyTest, EnqueueToStart) {
+    constexpr int streams = 4;
+    constexpr size_t tasksPerProducer = 500;
+    const size_t producers = GetParam();
+    const size_t totalTasks = producers * tasksPerProducer;
+
+    std::vector<int64_t> latencies(totalTasks);
+    std::atomic<size_t> executed{0};
+    std::promise<void> allExecuted;
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"CPUStreamsExecutorLatencyTest", streams, 1}};
+
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (size_t i = 0; i < tasksPerProducer; ++i) {
+                    const auto submitted = Clock::now();
+                    const size_t idx = p * tasksPerProducer + i;
+                    executor.run([&, submitted, idx] {
+                        latencies[idx] =
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - submitted).count();
+                        if (++executed == totalTasks)
+                            allExecuted.set_value();
+                    });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(allExecuted.get_future().wait_for(std::chrono::seconds(60)), std::future_status::ready);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "[ LATENCY  ] producers: " << producers << ", median: " << latencies[totalTasks / 2] / 1000.0
+              << " us, p99: " << latencies[totalTasks * 99 / 100] / 1000.0 << " us" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Producers,
+                         CPUStreamsExecutorLatencyTest,
+                         ::testing::Values(1, 8, 64),
+                         [](const ::testing::TestParamInfo<size_t>& info) {
+                             return "producers_" + std::to_string(info.param);
+                         });
+
+}  // namespace
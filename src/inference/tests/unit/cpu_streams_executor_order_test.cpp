@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+// Keeps a stream of the executor busy until released
+class BlockedStream {
+public:
+    explicit BlockedStream(CPUStreamsExecutor& executor) : m_released{m_release.get_future().share()} {
+        std::promise<void> started;
+        auto released = m_released;
+        executor.run([&started, released] {
+            started.set_value();
+            released.wait();
+        });
+        started.get_future().wait();
+    }
+    void release() {
+        m_release.set_value();
+    }
+
+private:
+    std::promise<void> m_release;
+    std::shared_future<void> m_released;
+};
+
+// The tasks are spread over the queues of the workers, but they are dispatched in the submission order anyway:
+// the only free worker runs the tasks queued to the blocked worker in turn with its own ones
+TEST(CPUStreamsExecutorOrderTest, TasksAreDispatchedInSubmissionOrder) {
+    constexpr size_t tasks = 64;
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"CPUStreamsExecutorOrderTest", 2, 1}};
+    BlockedStream first{executor};
+    BlockedStream second{executor};
+
+    std::mutex mutex;
+    std::condition_variable recorded;
+    std::vector<size_t> order;
+    for (size_t i = 0; i < tasks; ++i) {
+        executor.run([&, i] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(i);
+            recorded.notify_all();
+        });
+    }
+
+    first.release();
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        ASSERT_TRUE(recorded.wait_for(lock, std::chrono::seconds{60}, [&] {
+            return order.size() == tasks;
+        }));
+    }
+    second.release();
+
+    for (size_t i = 0; i < tasks; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+}  // namespace
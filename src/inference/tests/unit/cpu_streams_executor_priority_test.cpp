@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+// Keeps the only stream of the executor busy, so the tasks submitted meanwhile are queued
+class BlockedStream {
+public:
+    explicit BlockedStream(CPUStreamsExecutor& executor) : m_released{m_release.get_future().share()} {
+        std::promise<void> started;
+        auto released = m_released;
+        executor.run([&started, released] {
+            started.set_value();
+            released.wait();
+        });
+        started.get_future().wait();
+    }
+    void release() {
+        m_release.set_value();
+    }
+
+private:
+    std::promise<void> m_release;
+    std::shared_future<void> m_released;
+};
+
+class CPUStreamsExecutorPriorityTest : public ::testing::Test {
+protected:
+    Task record(const std::string& name) {
+        return [this, name] {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_order.push_back(name);
+            m_recorded.notify_all();
+        };
+    }
+
+    void wait_recorded(size_t count) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        ASSERT_TRUE(m_recorded.wait_for(lock, std::chrono::seconds{60}, [&] {
+            return m_order.size() >= count;
+        }));
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_recorded;
+    std::vector<std::string> m_order;
+};
+
+}  // namespace
+
+TEST_F(CPUStreamsExecutorPriorityTest, HigherPriorityAndEarlierDeadlineRunFirst) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"CPUStreamsExecutorPriorityTest", 1, 1}};
+    BlockedStream stream{executor};
+
+    const auto now = TaskPriority::Clock::now();
+    executor.run(record("medium"));
+    executor.run_with_priority(record("low"), TaskPriority{ov::hint::Priority::LOW});
+    executor.run_with_priority(record("high_late"), TaskPriority{ov::hint::Priority::HIGH, now + std::chrono::hours{2}});
+    executor.run_with_priority(record("high_early"), TaskPriority{ov::hint::Priority::HIGH, now + std::chrono::hours{1}});
+    executor.run_with_priority(record("medium_deadline"),
+                               TaskPriority{ov::hint::Priority::MEDIUM, now + std::chrono::hours{1}});
+
+    auto statistics = executor.get_queue_statistics();
+    ASSERT_EQ(statistics.size(), 3);
+    EXPECT_EQ(statistics[0].priority, ov::hint::Priority::HIGH);
+    EXPECT_EQ(statistics[0].depth, 2);
+    EXPECT_EQ(statistics[1].priority, ov::hint::Priority::MEDIUM);
+    EXPECT_EQ(statistics[1].depth, 2);
+    EXPECT_EQ(statistics[2].priority, ov::hint::Priority::LOW);
+    EXPECT_EQ(statistics[2].depth, 1);
+
+    stream.release();
+    wait_recorded(5);
+
+    const std::vector<std::string> expected{"high_early", "high_late", "medium_deadline", "medium", "low"};
+    EXPECT_EQ(m_order, expected);
+
+    statistics = executor.get_queue_statistics();
+    EXPECT_EQ(statistics[0].depth, 0);
+    EXPECT_EQ(statistics[0].dispatched, 2);
+    EXPECT_LE(statistics[0].max_delay, statistics[0].total_delay);
+    EXPECT_EQ(statistics[2].dispatched, 1);
+}
+
+TEST_F(CPUStreamsExecutorPriorityTest, LowerPriorityIsNotStarved) {
+    constexpr size_t highTasks = 100;
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"CPUStreamsExecutorPriorityTest", 1, 1}};
+    BlockedStream stream{executor};
+
+    executor.run_with_priority(record("low"), TaskPriority{ov::hint::Priority::LOW});
+    for (size_t i = 0; i < highTasks; ++i) {
+        executor.run_with_priority(record("high"), TaskPriority{ov::hint::Priority::HIGH});
+    }
+
+    stream.release();
+    wait_recorded(highTasks + 1);
+
+    ASSERT_EQ(m_order.size(), highTasks + 1);
+    const auto low = std::find(m_order.begin(), m_order.end(), "low");
+    ASSERT_NE(low, m_order.end());
+    EXPECT_LT(static_cast<size_t>(low - m_order.begin()), highTasks);
+}
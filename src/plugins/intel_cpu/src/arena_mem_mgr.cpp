@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arena_mem_mgr.h"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+inline size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+}   // namespace
+
+ArenaMemoryMngr::ArenaMemoryMngr(std::shared_ptr<DynamicMemoryArena> arena) : m_arena(std::move(arena)) {
+    OPENVINO_ASSERT(m_arena, "Memory arena is uninitialized");
+}
+
+void* ArenaMemoryMngr::getRawPtr() const noexcept {
+    return m_data;
+}
+
+void ArenaMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    m_useExternalStorage = true;
+    m_size = size;
+    m_data = ptr;
+    m_fallback.reset();
+}
+
+bool ArenaMemoryMngr::resize(size_t size) {
+    // the buffer of the previous layout may be given to another manager, so it's replaced even if it's big enough
+    const bool relaidOut = !m_useExternalStorage && m_data && m_layout != m_arena->getLayout();
+    if (size <= m_size && !relaidOut) {
+        return false;
+    }
+    size = std::max(size, m_size);
+    m_fallback.reset();
+    m_data = nullptr;
+    m_size = 0ul;
+    void* data = m_arena->allocate(size);
+    if (!data) {
+        m_fallback = m_arena->allocateFallback(size);
+        data = m_fallback.get();
+    }
+    m_data = data;
+    m_size = size;
+    m_layout = m_arena->getLayout();
+    m_useExternalStorage = false;
+    return true;
+}
+
+bool ArenaMemoryMngr::hasExtBuffer() const noexcept {
+    return m_useExternalStorage;
+}
+
+DynamicMemoryArena::DynamicMemoryArena(MemoryAllocator::Ptr allocator, float growthFactor)
+    : m_allocator(allocator ? std::move(allocator) : MemoryAllocator::getDefault()),
+      m_growthFactor(growthFactor) {}
+
+MemoryMngrPtr DynamicMemoryArena::createMemoryMngr() {
+    auto arenaMngr = make_unique<ArenaMemoryMngr>(shared_from_this());
+    const auto* arenaMngrPtr = arenaMngr.get();
+    auto mngr = std::make_shared<DnnlMemoryMngr>(std::move(arenaMngr));
+    m_clients.push_back({mngr, arenaMngrPtr});
+    return mngr;
+}
+
+void* DynamicMemoryArena::allocate(size_t size) {
+    const size_t chunkSize = roundUp(size, MemoryAllocator::cacheLineSize);
+    if (!m_block || m_offset + chunkSize > m_capacity) {
+        return nullptr;
+    }
+    void* ptr = static_cast<uint8_t*>(m_block.get()) + m_offset;
+    m_offset += chunkSize;
+    updatePeakUsage();
+    return ptr;
+}
+
+MemoryAllocator::Buffer DynamicMemoryArena::allocateFallback(size_t size) {
+    auto buffer = m_allocator->allocate(size);
+    if (!buffer) {
+        IE_THROW() << "Failed to allocate " << size << " bytes of memory";
+    }
+    m_fallbackBytes += size;
+    m_fallbackAllocations++;
+    if (const auto& statistics = m_allocator->getStatistics()) {
+        statistics->arenaFallbackAllocations++;
+    }
+    updatePeakUsage();
+    return buffer;
+}
+
+void DynamicMemoryArena::updatePeakUsage() {
+    m_peakUsage = std::max(m_peakUsage, m_offset + m_fallbackBytes);
+    if (const auto& statistics = m_allocator->getStatistics()) {
+        // the arenas of all the streams report to the same statistics
+        auto peak = statistics->arenaPeakUsage.load();
+        while (peak < m_peakUsage && !statistics->arenaPeakUsage.compare_exchange_weak(peak, m_peakUsage)) {
+        }
+    }
+}
+
+void DynamicMemoryArena::reset() {
+    if (m_fallbackBytes == 0) {
+        return;
+    }
+
+    m_clients.erase(std::remove_if(m_clients.begin(), m_clients.end(),
+                                   [](const Client& client) {
+                                       return client.mngr.expired();
+                                   }),
+                    m_clients.end());
+
+    size_t required = 0;
+    for (const auto& client : m_clients) {
+        if (!client.arenaMngr->hasExtBuffer()) {
+            required += roundUp(client.arenaMngr->getSize(), MemoryAllocator::cacheLineSize);
+        }
+    }
+    if (required > m_capacity) {
+        // the block grows geometrically, so a model with the growing shapes overflows it a logarithmic number of times
+        size_t capacity = std::max(required, static_cast<size_t>(m_capacity * m_growthFactor));
+        m_block.reset();
+        m_capacity = 0;
+        m_block = m_allocator->allocate(capacity);
+        if (!m_block) {
+            IE_THROW() << "Failed to allocate " << capacity << " bytes of memory";
+        }
+        m_capacity = capacity;
+    }
+    DEBUG_LOG("Dynamic memory arena ", this, " relaid out: ", required, " of ", m_capacity, " bytes, ",
+              m_fallbackBytes, " bytes allocated aside");
+
+    m_offset = 0;
+    m_fallbackBytes = 0;
+    m_layout++;
+    // the managers take their buffers from the new layout and notify their memory objects
+    for (const auto& client : m_clients) {
+        if (auto mngr = client.mngr.lock()) {
+            mngr->resize(client.arenaMngr->getSize());
+        }
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+class DynamicMemoryArena;
+
+/**
+ * @brief A memory manager which takes its buffer from the arena of the dynamic tensors of a graph.
+ * As MemoryMngrWithReuse, the buffer is replaced only if a bigger one is requested or the arena is relaid out.
+ */
+class ArenaMemoryMngr : public IMemoryMngr {
+public:
+    explicit ArenaMemoryMngr(std::shared_ptr<DynamicMemoryArena> arena);
+
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    size_t getSize() const noexcept {
+        return m_size;
+    }
+
+private:
+    std::shared_ptr<DynamicMemoryArena> m_arena;
+    void* m_data = nullptr;
+    size_t m_size = 0ul;    // the largest size requested so far
+    size_t m_layout = 0ul;  // the layout of the arena the buffer belongs to
+    bool m_useExternalStorage = false;
+    MemoryAllocator::Buffer m_fallback;  // the buffer allocated aside if the arena is full, until the arena is reset
+};
+
+/**
+ * @brief Bump allocator of the intermediate dynamic tensors of a graph.
+ *
+ * The memory managers of the dynamic groups take their buffers from one block by bumping an offset, so the inferences
+ * with the shapes seen before don't allocate any memory. A buffer which doesn't fit into the rest of the block is
+ * allocated aside as a fallback. The graph resets the arena after each inference: if there were fallbacks, the block
+ * is grown to the sum of the buffers of all the managers and the buffers are laid out in it again, releasing the
+ * fallbacks. Otherwise the reset is a no-op, since the managers of the nodes with unchanged shapes are not resized
+ * and keep their buffers.
+ * The data of the buffers is not preserved by the reset, so the tensors living across the inferences (the inputs and
+ * the outputs of the graph) must not be placed in the arena. The arena is used by the stream owning the graph only,
+ * so it's not thread-safe.
+ */
+class DynamicMemoryArena : public std::enable_shared_from_this<DynamicMemoryArena> {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryArena>;
+
+    /**
+     * @param allocator allocator of the block and the fallback buffers, the arena counters are added to its statistics
+     * @param growthFactor growth factor of the block, see MemoryMngrWithReuse
+     */
+    explicit DynamicMemoryArena(MemoryAllocator::Ptr allocator,
+                                float growthFactor = MemoryMngrWithReuse::dynamicGrowthFactor);
+
+    MemoryMngrPtr createMemoryMngr();
+
+    void reset();
+
+    size_t getCapacity() const {
+        return m_capacity;
+    }
+
+    // the largest memory used by the buffers of the managers within one inference, including the fallbacks
+    size_t getPeakUsage() const {
+        return m_peakUsage;
+    }
+
+    size_t getFallbackAllocations() const {
+        return m_fallbackAllocations;
+    }
+
+private:
+    friend class ArenaMemoryMngr;
+
+    // returns null if the buffer doesn't fit into the rest of the block
+    void* allocate(size_t size);
+    MemoryAllocator::Buffer allocateFallback(size_t size);
+    void updatePeakUsage();
+
+    size_t getLayout() const {
+        return m_layout;
+    }
+
+    struct Client {
+        std::weak_ptr<IMemoryMngrObserver> mngr;
+        const ArenaMemoryMngr* arenaMngr;  // owned by the manager above
+    };
+
+    MemoryAllocator::Ptr m_allocator;
+    float m_growthFactor;
+    MemoryAllocator::Buffer m_block;
+    size_t m_capacity = 0ul;
+    size_t m_offset = 0ul;
+    size_t m_fallbackBytes = 0ul;
+    size_t m_layout = 0ul;
+    size_t m_peakUsage = 0ul;
+    size_t m_fallbackAllocations = 0ul;
+    std::vector<Client> m_clients;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,14 +4,66 @@
 
 #include "async_infer_request.h"
 #include <memory>
+#include "internal_properties.hpp"
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      m_inferRequest(static_cast<InferRequestBase*>(inferRequest.get())),
+      m_priorityExecutor(std::make_shared<PriorityExecutor>(taskExecutor)) {
+    m_inferRequest->SetAsyncRequest(this);
+    _pipeline = {{m_priorityExecutor, [this] {
+                      m_inferRequest->InferImpl();
+                  }}};
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
     StopAndWait();
 }
+
+void ov::intel_cpu::AsyncInferRequest::Cancel() {
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::Cancel();
+    // the running inference is interrupted inside the graph as well, not only between the pipeline stages
+    m_inferRequest->Cancel();
+}
+
+void ov::intel_cpu::AsyncInferRequest::SetProperties(const ov::AnyMap& properties) {
+    CheckState();
+    auto priority = m_priority;
+    auto latencyBudget = m_latencyBudget;
+    bool hasLatencyBudget = false;
+    for (const auto& property : properties) {
+        if (property.first == ov::hint::priority.name()) {
+            priority = property.second.as<ov::hint::Priority>();
+        } else if (property.first == ov::intel_cpu::latency_budget.name()) {
+            latencyBudget = std::chrono::microseconds(property.second.as<uint32_t>());
+            hasLatencyBudget = true;
+        } else {
+            IE_THROW(NotFound) << "Unsupported infer request property: " << property.first;
+        }
+    }
+    m_priority = priority;
+    if (hasLatencyBudget) {
+        // the budget of the request overrides the budget of the compiled model
+        m_latencyBudget = latencyBudget;
+        m_inferRequest->SetLatencyBudget(latencyBudget);
+    }
+}
+
+void ov::intel_cpu::AsyncInferRequest::StartAsync_ThreadUnsafe() {
+    // the first stage is run by the executor right away, so the priority of the run is not changed until it is queued
+    m_priorityExecutor->m_priority.priority = m_priority;
+    m_priorityExecutor->m_priority.deadline = m_latencyBudget.count() > 0
+                                                  ? ov::threading::TaskPriority::Clock::now() + m_latencyBudget
+                                                  : ov::threading::TaskPriority::Clock::time_point::max();
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+}
+
+void ov::intel_cpu::AsyncInferRequest::PriorityExecutor::run(InferenceEngine::Task task) {
+    if (m_priority.is_default()) {
+        m_executor->run(std::move(task));
+    } else {
+        m_executor->run_with_priority(std::move(task), m_priority);
+    }
+}
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <openvino/runtime/threading/itask_executor.hpp>
 #include "infer_request.h"
 
 namespace ov {
@@ -18,6 +20,33 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+    void Cancel() override;
+
+    /**
+     * @brief Sets the scheduling properties of the following asynchronous runs of the request:
+     * ov::hint::priority and ov::intel_cpu::latency_budget (the deadline of the run on the task executor, the
+     * inference out of the budget is interrupted, see InferRequestBase::SetLatencyBudget)
+     */
+    void SetProperties(const ov::AnyMap& properties) override;
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+
+private:
+    // Runs the tasks of the pipeline by the task executor of the compiled model with the priority of the current run
+    struct PriorityExecutor : public InferenceEngine::ITaskExecutor {
+        explicit PriorityExecutor(const InferenceEngine::ITaskExecutor::Ptr& executor) : m_executor{executor} {}
+        void run(InferenceEngine::Task task) override;
+
+        InferenceEngine::ITaskExecutor::Ptr m_executor;
+        ov::threading::TaskPriority m_priority;
+    };
+
+    InferRequestBase* m_inferRequest;
+    std::shared_ptr<PriorityExecutor> m_priorityExecutor;
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
+    std::chrono::microseconds m_latencyBudget{0};
 };
 
 }   // namespace intel_cpu
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <functional>
+#include <mutex>
 #include "lru_cache.h"
 
 namespace ov {
@@ -19,6 +20,7 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual size_t size() const = 0;
 };
 
 /**
@@ -55,19 +57,34 @@ public:
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
+        ValType retVal;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            retVal = _impl.get(key);
+        }
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
+            // the value is built without the lock, since the builders may use the cache as well
             retStatus = LookUpStatus::Miss;
             retVal = builder(key);
-            if (retVal != retEmpty)
+            if (retVal != retEmpty) {
+                std::lock_guard<std::mutex> lock(_mutex);
                 _impl.put(key, retVal);
+            }
         }
         return {retVal, retStatus};
     }
 
+    size_t size() const override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _impl.size();
+    }
+
 public:
     ImplType _impl;
+
+private:
+    mutable std::mutex _mutex;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_plan_cache.h"
+
+#include <common/primitive_hashing_utils.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+DynamicPlanCache::DynamicPlanCache(size_t byteBudget, size_t planSize)
+    : cache(planSize ? byteBudget / planSize : 0) {}
+
+size_t DynamicPlanCache::Key::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
+bool DynamicPlanCache::Key::operator==(const Key& rhs) const {
+    return inputDims == rhs.inputDims;
+}
+
+DynamicPlanCache::PlanCPtr DynamicPlanCache::find(const Dims& inputDims) {
+    return cache.get(Key{inputDims});
+}
+
+void DynamicPlanCache::add(const Dims& inputDims, const PlanCPtr& plan) {
+    cache.put(Key{inputDims}, plan);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cpu_types.h"
+#include "lru_cache.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Cache of the shape plans of a dynamic graph keyed by the shapes of the graph inputs.
+ *
+ * A plan holds the output dims of all the executable nodes computed for one set of the input shapes, so an inference with
+ * a repeated set of the input shapes redefines the memory of the nodes directly instead of running the shape inference
+ * node by node. The cache is limited by the estimated size of the plans in bytes, the least recently used plans are evicted.
+ *
+ * @attention This cache implementation IS NOT THREAD SAFE! Each graph owns its cache.
+ */
+class DynamicPlanCache {
+public:
+    using Ptr = std::shared_ptr<DynamicPlanCache>;
+
+    using Dims = std::vector<VectorDims>;
+    // output dims of the executable nodes in the execution order, empty for the static nodes
+    using Plan = std::vector<Dims>;
+    using PlanCPtr = std::shared_ptr<const Plan>;
+
+    /**
+     * @param byteBudget maximum estimated size in bytes of the stored plans
+     * @param planSize estimated size in bytes of one plan including its key
+     * @note the cache stores nothing if the budget doesn't fit a single plan
+     */
+    DynamicPlanCache(size_t byteBudget, size_t planSize);
+
+    /**
+     * @brief Searches the plan made for the input shapes
+     * @return nullptr if there is no such plan
+     */
+    PlanCPtr find(const Dims& inputDims);
+
+    void add(const Dims& inputDims, const PlanCPtr& plan);
+
+    size_t size() const noexcept {
+        return cache.size();
+    }
+
+    size_t getCapacity() const noexcept {
+        return cache.getCapacity();
+    }
+
+private:
+    struct Key {
+        size_t hash() const;
+        bool operator==(const Key& rhs) const;
+
+        Dims inputDims;
+    };
+
+    LruCache<Key, PlanCPtr> cache;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
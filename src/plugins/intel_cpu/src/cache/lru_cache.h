@@ -26,6 +26,10 @@ public:
 public:
     explicit LruCache(size_t capacity) : _capacity(capacity) {}
 
+    // the copied map would refer to the list of the original cache
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
     /**
      * @brief Puts the value associated with the key into the cache.
      * @param key
@@ -85,6 +89,13 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of stored records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
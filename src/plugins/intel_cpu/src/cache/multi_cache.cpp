@@ -4,10 +4,60 @@
 
 #include "multi_cache.h"
 
+#include <algorithm>
+
 namespace ov {
 namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::MultiCache(size_t capacity, size_t numShards) : _capacity(capacity) {
+    numShards = std::max<size_t>(1, numShards);
+    // the records limit is rounded up, so a small non zero capacity still keeps some records in each shard
+    _shardCapacity = (capacity + numShards - 1) / numShards;
+    for (size_t i = 0; i < numShards; i++) {
+        _shards.emplace_back(new Shard());
+    }
+}
+
+void MultiCache::insertRecord(Shard& shard, std::unique_ptr<RecordBase> record) {
+    const auto hash = record->hash;
+    _size++;
+    shard.lruList.push_front(std::move(record));
+    shard.index.insert({hash, shard.lruList.begin()});
+
+    while (shard.lruList.size() > _shardCapacity) {
+        auto last = std::prev(shard.lruList.end());
+        auto range = shard.index.equal_range((*last)->hash);
+        for (auto itr = range.first; itr != range.second; ++itr) {
+            if (itr->second == last) {
+                shard.index.erase(itr);
+                break;
+            }
+        }
+        _size--;
+        shard.lruList.erase(last);
+        _evictions++;
+    }
+}
+
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics statistics;
+    statistics.hits = _hits;
+    statistics.misses = _misses;
+    statistics.evictions = _evictions;
+    statistics.capacity = _capacity;
+    if (isSharded()) {
+        statistics.size = _size;
+    } else {
+        // the capacity of the records mode is set per Key/Value type
+        std::lock_guard<std::mutex> lock(_storageMutex);
+        statistics.capacity = _capacity * _storage.size();
+        for (const auto& entry : _storage)
+            statistics.size += entry.second->size();
+    }
+    return statistics;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
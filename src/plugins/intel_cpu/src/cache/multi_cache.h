@@ -7,6 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <list>
+#include <mutex>
+#include <vector>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +18,12 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The cache works in one of two modes:
+ * - records mode: each pair of Key/Value types has its own LRU storage limited by the number of records.
+ * - sharded mode: the records of all the Key/Value types are stored in the common LRU storage, which is split into
+ *   independently locked shards by the key hash. The storage is limited by the total number of records,
+ *   so the cache may be shared by the graphs executed simultaneously.
+ * Both modes are thread safe, since the nodes of a graph update their parameters from several threads.
  */
 
 class MultiCache {
@@ -26,6 +34,14 @@ public:
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t size = 0;      // number of records
+        size_t capacity = 0;  // maximum number of records
+    };
+
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
@@ -33,6 +49,13 @@ public:
     */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+    * @brief Creates the thread safe sharded cache
+    * @param capacity maximum number of records of all the Key/Value types, the records limit is split evenly among the shards
+    * @param numShards number of independently locked shards
+    */
+    MultiCache(size_t capacity, size_t numShards);
+
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
     *       using the key and the builder functor and adds the new record to the cache
@@ -45,20 +68,83 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (!_shards.empty()) {
+            return getOrCreateShared<KeyType, ValueType>(key, builder);
+        }
         auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        auto result = entry->getOrCreate(key, std::move(builder));
+        if (result.second == CacheEntryBase::LookUpStatus::Hit) {
+            _hits++;
+        } else {
+            _misses++;
+        }
+        return result;
     }
 
+    bool isSharded() const {
+        return !_shards.empty();
+    }
+
+    /**
+    * @brief Returns the lookup counters and the occupancy of the cache. The evictions are counted in the sharded mode only.
+    */
+    Statistics getStatistics() const;
+
 private:
+    struct RecordBase {
+        RecordBase(size_t typeId, size_t hash) : typeId(typeId), hash(hash) {}
+        virtual ~RecordBase() = default;
+
+        size_t typeId;
+        size_t hash;
+    };
+
+    template<typename KeyType, typename ValueType>
+    struct Record : public RecordBase {
+        Record(size_t typeId, size_t hash, const KeyType& key, const ValueType& value)
+            : RecordBase(typeId, hash), key(key), value(value) {}
+
+        KeyType key;
+        ValueType value;
+    };
+
+    using RecordList = std::list<std::unique_ptr<RecordBase>>;
+
+    struct Shard {
+        std::mutex mutex;
+        RecordList lruList;
+        std::unordered_multimap<size_t, RecordList::iterator> index;
+    };
+
     template<typename T>
     size_t getTypeId();
     template<typename KeyType, typename ValueType>
     EntryPtr<KeyType, ValueType> getEntry();
 
+    template<typename KeyType, typename ValueType>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreateShared(const KeyType& key, const std::function<ValueType(const KeyType&)>& builder);
+
+    // must be called under the shard lock
+    template<typename KeyType, typename ValueType>
+    RecordList::iterator findRecord(Shard& shard, size_t typeId, size_t hash, const KeyType& key);
+
+    // must be called under the shard lock
+    void insertRecord(Shard& shard, std::unique_ptr<RecordBase> record);
+
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _shardCapacity = 0;
+    std::atomic<size_t> _size{0};
+
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _evictions{0};
 };
 
 template<typename T>
@@ -71,6 +157,7 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -79,6 +166,54 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     return std::static_pointer_cast<EntryType>(itr->second);
 }
 
+template<typename KeyType, typename ValueType>
+MultiCache::RecordList::iterator MultiCache::findRecord(Shard& shard, size_t typeId, size_t hash, const KeyType& key) {
+    using RecordType = Record<KeyType, ValueType>;
+    auto range = shard.index.equal_range(hash);
+    for (auto itr = range.first; itr != range.second; ++itr) {
+        const auto& record = *itr->second;
+        if (record->typeId == typeId && static_cast<const RecordType&>(*record).key == key)
+            return itr->second;
+    }
+    return shard.lruList.end();
+}
+
+template<typename KeyType, typename ValueType>
+typename CacheEntry<KeyType, ValueType>::ResultType
+MultiCache::getOrCreateShared(const KeyType& key, const std::function<ValueType(const KeyType&)>& builder) {
+    using RecordType = Record<KeyType, ValueType>;
+    const size_t typeId = getTypeId<RecordType>();
+    const size_t keyHash = static_cast<size_t>(key.hash());
+    const size_t hash = keyHash ^ (typeId + 0x9e3779b9 + (keyHash << 6) + (keyHash >> 2));
+    auto& shard = *_shards[hash % _shards.size()];
+
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto itr = findRecord<KeyType, ValueType>(shard, typeId, hash, key);
+        if (itr != shard.lruList.end()) {
+            shard.lruList.splice(shard.lruList.begin(), shard.lruList, itr);
+            _hits++;
+            return {static_cast<const RecordType&>(**itr).value, CacheEntryBase::LookUpStatus::Hit};
+        }
+    }
+
+    // the value is built without the lock, since the builders may use the cache as well
+    _misses++;
+    ValueType value = builder(key);
+    if (value == ValueType())
+        return {value, CacheEntryBase::LookUpStatus::Miss};
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    // the same value might be created by another thread meanwhile, the first one is kept to share it
+    auto itr = findRecord<KeyType, ValueType>(shard, typeId, hash, key);
+    if (itr != shard.lruList.end()) {
+        shard.lruList.splice(shard.lruList.begin(), shard.lruList, itr);
+        return {static_cast<const RecordType&>(**itr).value, CacheEntryBase::LookUpStatus::Miss};
+    }
+    insertRecord(shard, std::unique_ptr<RecordBase>(new RecordType(typeId, hash, key, value)));
+    return {value, CacheEntryBase::LookUpStatus::Miss};
+}
+
 using MultiCacheWeakPtr = std::weak_ptr<MultiCache>;
 using MultiCacheWeakCPtr = std::weak_ptr<const MultiCache>;
 using MultiCachePtr = std::shared_ptr<MultiCache>;
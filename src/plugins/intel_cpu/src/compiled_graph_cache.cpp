@@ -0,0 +1,233 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compiled_graph_cache.h"
+
+#include "graph.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "utils/general_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace {
+
+constexpr char compiledGraphMagic[8] = {'C', 'P', 'U', 'G', 'R', 'A', 'P', 'H'};
+constexpr uint32_t compiledGraphVersion = 2;
+// the stored weights are aligned the same way as the plugin allocates memory
+constexpr size_t weightsAlignment = 64;
+
+// the primitives and the weights layouts depend on the instruction set, so they are valid only for the same one
+uint64_t cpuIsaMask() {
+    using namespace dnnl::impl::cpu::x64;
+    const cpu_isa_t isas[] = {sse41, avx, avx2, avx512_core, avx512_core_vnni, avx512_core_bf16,
+                              avx512_core_fp16, avx512_core_amx};
+    uint64_t mask = 0;
+    for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); i++) {
+        if (mayiuse(isas[i]))
+            mask |= uint64_t(1) << i;
+    }
+    return mask;
+}
+
+template <typename T>
+void write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write(std::ostream& stream, const std::string& value) {
+    write(stream, static_cast<uint64_t>(value.size()));
+    stream.write(value.data(), value.size());
+}
+
+template <typename T>
+bool read(std::istream& stream, T& value) {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool read(std::istream& stream, std::string& value) {
+    uint64_t size = 0;
+    if (!read(stream, size))
+        return false;
+    value.resize(size);
+    return static_cast<bool>(stream.read(&value[0], size));
+}
+
+}   // namespace
+
+std::string CompiledGraphCache::weightsKey(const std::string& nodeName, const MemoryDesc& desc) {
+    return nodeName + "_" + desc.getPrecision().name() + "_" + desc.serializeFormat() + "_" +
+           std::to_string(desc.getCurrentMemSize());
+}
+
+std::string CompiledGraphCache::portsKey(const NodeConfig& config) {
+    std::string key;
+    auto append = [&key](const std::vector<PortConfig>& confs) {
+        for (const auto& conf : confs) {
+            const auto desc = conf.getMemDesc();
+            key += desc ? std::string(desc->getPrecision().name()) + ":" + desc->serializeFormat() : std::string("none");
+            key += ";";
+        }
+    };
+    append(config.inConfs);
+    key += "->";
+    append(config.outConfs);
+    return key;
+}
+
+void CompiledGraphCache::serialize(std::ostream& stream, const Graph& graph) {
+    struct StoredWeights {
+        std::string key;
+        MemoryCPtr memory;
+    };
+    std::vector<std::pair<std::string, SelectedPrimitive>> selected;
+    std::vector<StoredWeights> stored;
+    for (const auto& node : graph.GetNodes()) {
+        const auto selectedPD = node->getSelectedPrimitiveDescriptor();
+        if (selectedPD) {
+            // the supported descriptor is stored, the selected one may be refined by the node after the selection
+            const int index = node->getSelectedPrimitiveDescriptorIndex();
+            const auto& supportedPD = node->getSupportedPrimitiveDescriptors()[index];
+            selected.push_back({node->getName(), {index, supportedPD.getImplementationType(), portsKey(supportedPD.getConfig())}});
+        }
+        for (const auto& preparedWeights : node->getPreparedWeights()) {
+            const auto& memory = preparedWeights.second;
+            if (memory && memory->isAllocated())
+                stored.push_back({weightsKey(node->getName(), memory->getDesc()), memory});
+        }
+    }
+
+    // the tables are small, they are written first to get the size of the section
+    std::stringstream tables;
+    write(tables, compiledGraphVersion);
+    write(tables, cpuIsaMask());
+
+    write(tables, static_cast<uint64_t>(selected.size()));
+    for (const auto& primitive : selected) {
+        write(tables, primitive.first);
+        write(tables, static_cast<int32_t>(primitive.second.index));
+        write(tables, static_cast<int64_t>(primitive.second.implType));
+        write(tables, primitive.second.ports);
+    }
+
+    size_t dataSize = 0;
+    write(tables, static_cast<uint64_t>(stored.size()));
+    for (const auto& weightsEntry : stored) {
+        const size_t size = weightsEntry.memory->getSize();
+        write(tables, weightsEntry.key);
+        write(tables, static_cast<uint64_t>(dataSize));
+        write(tables, static_cast<uint64_t>(size));
+        dataSize += rnd_up(size, weightsAlignment);
+    }
+    write(tables, static_cast<uint64_t>(dataSize));
+
+    const std::string tablesData = tables.str();
+    stream.write(compiledGraphMagic, sizeof(compiledGraphMagic));
+    write(stream, static_cast<uint64_t>(tablesData.size() + dataSize));
+    stream.write(tablesData.data(), tablesData.size());
+
+    const std::vector<char> padding(weightsAlignment, 0);
+    for (const auto& weightsEntry : stored) {
+        const size_t size = weightsEntry.memory->getSize();
+        stream.write(static_cast<const char*>(weightsEntry.memory->getData()), size);
+        stream.write(padding.data(), rnd_up(size, weightsAlignment) - size);
+    }
+}
+
+bool CompiledGraphCache::deserializeSection(std::istream& stream, CompiledGraphCache& cache) {
+    uint32_t version = 0;
+    uint64_t isaMask = 0;
+    if (!read(stream, version) || version != compiledGraphVersion || !read(stream, isaMask) || isaMask != cpuIsaMask())
+        return false;
+
+    uint64_t primitivesCount = 0;
+    if (!read(stream, primitivesCount))
+        return false;
+    for (uint64_t i = 0; i < primitivesCount; i++) {
+        std::string name;
+        int32_t index = -1;
+        int64_t implType = 0;
+        std::string ports;
+        if (!read(stream, name) || !read(stream, index) || !read(stream, implType) || !read(stream, ports))
+            return false;
+        cache.primitives[name] = {index, static_cast<impl_desc_type>(implType), ports};
+    }
+
+    uint64_t weightsCount = 0;
+    if (!read(stream, weightsCount))
+        return false;
+    for (uint64_t i = 0; i < weightsCount; i++) {
+        std::string key;
+        uint64_t offset = 0, size = 0;
+        if (!read(stream, key) || !read(stream, offset) || !read(stream, size))
+            return false;
+        cache.weights[key] = {offset, size};
+    }
+
+    // all the weights are read at once into a single buffer, the nodes use them in place
+    uint64_t dataSize = 0;
+    if (!read(stream, dataSize))
+        return false;
+    if (dataSize) {
+        cache.weightsData = makeWeightsMemory(cache.eng, std::make_shared<CpuBlockedMemoryDesc>(Precision::U8, Shape{dataSize}));
+        if (!stream.read(static_cast<char*>(cache.weightsData->getData()), dataSize))
+            return false;
+    }
+    return true;
+}
+
+CompiledGraphCache::Ptr CompiledGraphCache::deserialize(std::istream& stream, const dnnl::engine& eng) {
+    const auto start = stream.tellg();
+    char magic[sizeof(compiledGraphMagic)] = {};
+    uint64_t sectionSize = 0;
+    if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, compiledGraphMagic, sizeof(magic)) != 0 ||
+        !read(stream, sectionSize)) {
+        // the blob has been exported without the compiled state, the data which follows it is not touched
+        stream.clear();
+        stream.seekg(start);
+        return nullptr;
+    }
+
+    const auto sectionStart = stream.tellg();
+    auto cache = std::make_shared<CompiledGraphCache>();
+    cache->eng = eng;
+    const bool valid = deserializeSection(stream, *cache);
+    // the section is skipped as a whole whatever part of it was read
+    stream.clear();
+    stream.seekg(sectionStart + static_cast<std::streamoff>(sectionSize));
+    return valid ? cache : nullptr;
+}
+
+int CompiledGraphCache::getSelectedPrimitive(const Node& node) const {
+    auto it = primitives.find(node.getName());
+    if (it == primitives.end())
+        return -1;
+    const auto& supportedPDs = node.getSupportedPrimitiveDescriptors();
+    const auto& stored = it->second;
+    if (stored.index < 0 || static_cast<size_t>(stored.index) >= supportedPDs.size())
+        return -1;
+    const auto& supportedPD = supportedPDs[stored.index];
+    if (supportedPD.getImplementationType() != stored.implType || portsKey(supportedPD.getConfig()) != stored.ports)
+        return -1;
+    return stored.index;
+}
+
+MemoryPtr CompiledGraphCache::getWeights(const std::string& nodeName, const MemoryDescPtr& desc) const {
+    auto it = weights.find(weightsKey(nodeName, *desc));
+    if (!weightsData || it == weights.end() || it->second.size != desc->getCurrentMemSize())
+        return nullptr;
+    auto data = static_cast<uint8_t*>(weightsData->getData()) + it->second.offset;
+    // the memory doesn't own the data, the buffer lives as long as the cache
+    return std::make_shared<Memory>(eng, desc, data, false);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
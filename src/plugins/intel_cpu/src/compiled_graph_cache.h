@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "onednn/iml_type_mapper.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+class Graph;
+class Node;
+struct NodeConfig;
+
+/**
+ * @brief Compiled state of a graph stored in the exported model blob right after the IR:
+ * the primitive descriptors selected for the nodes and the constant weights already reordered
+ * to the layouts required by the primitives.
+ *
+ * On import the graph is built from the IR as usual, but the nodes take the stored primitive descriptors and
+ * use the stored weights as is, so neither the descriptor selection nor the weights reordering has to be repeated.
+ * The section is prefixed with its size, so it is skipped if it was produced by another version of the format or on
+ * a CPU with a different instruction set.
+ */
+class CompiledGraphCache {
+public:
+    typedef std::shared_ptr<CompiledGraphCache> Ptr;
+    typedef std::shared_ptr<const CompiledGraphCache> CPtr;
+
+    /**
+     * @brief Writes the compiled state of the graph to the stream
+     */
+    static void serialize(std::ostream& stream, const Graph& graph);
+
+    /**
+     * @brief Reads the compiled state written by serialize() at the current stream position
+     * @return nullptr if the stream has no compiled state or it can't be used on this CPU
+     */
+    static Ptr deserialize(std::istream& stream, const dnnl::engine& eng);
+
+    /**
+     * @brief Returns the index of the primitive descriptor selected for the node when the model was exported,
+     * -1 if the node is unknown or its supported descriptor at the index differs from the stored one
+     * by the implementation type or by the precisions and the layouts of the ports
+     */
+    int getSelectedPrimitive(const Node& node) const;
+
+    /**
+     * @brief Returns the weights of the node stored in the layout described by desc, nullptr if there are no such weights
+     */
+    MemoryPtr getWeights(const std::string& nodeName, const MemoryDescPtr& desc) const;
+
+private:
+    struct SelectedPrimitive {
+        int index;
+        impl_desc_type implType;
+        std::string ports;  // precisions and layouts of the input and output ports
+    };
+
+    struct WeightsEntry {
+        size_t offset;
+        size_t size;
+    };
+
+    static std::string weightsKey(const std::string& nodeName, const MemoryDesc& desc);
+    static std::string portsKey(const NodeConfig& config);
+    static bool deserializeSection(std::istream& stream, CompiledGraphCache& cache);
+
+    dnnl::engine eng;
+    std::unordered_map<std::string, SelectedPrimitive> primitives;
+    std::unordered_map<std::string, WeightsEntry> weights;
+    MemoryPtr weightsData;  // single buffer holding all the stored weights
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
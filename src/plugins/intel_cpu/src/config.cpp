@@ -15,6 +15,7 @@
 #include "ie_system_conf.h"
 
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "internal_properties.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "utils/debug_capabilities.h"
@@ -115,6 +116,73 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
                 IE_THROW() << "Wrong value " << val << "for property key " << ov::hint::enable_hyper_threading.name()
                            << ". Expected only true/false." << std::endl;
             }
+        } else if (key == ov::intel_cpu::inter_op_parallelism.name()) {
+            if (val == PluginConfigParams::YES) {
+                interOpParallelism = true;
+            } else if (val == PluginConfigParams::NO) {
+                interOpParallelism = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::inter_op_parallelism.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::hybrid_node_placement.name()) {
+            if (val == PluginConfigParams::YES) {
+                hybridNodePlacement = true;
+            } else if (val == PluginConfigParams::NO) {
+                hybridNodePlacement = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::hybrid_node_placement.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::numa_local_activations.name()) {
+            if (val == PluginConfigParams::YES) {
+                numaLocalActivations = true;
+            } else if (val == PluginConfigParams::NO) {
+                numaLocalActivations = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::numa_local_activations.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::dynamic_memory_arena.name()) {
+            if (val == PluginConfigParams::YES) {
+                dynamicMemoryArena = true;
+            } else if (val == PluginConfigParams::NO) {
+                dynamicMemoryArena = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::dynamic_memory_arena.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::state_slots.name()) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::state_slots.name()
+                           << ". Expected only integer numbers";
+            }
+            // any negative value is treated as zero that means disabling the slots
+            stateSlots = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (key == ov::intel_cpu::latency_budget.name()) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::latency_budget.name()
+                           << ". Expected only integer numbers";
+            }
+            // any negative value is treated as zero that means no budget
+            latencyBudget = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (key == ov::intel_cpu::huge_pages.name()) {
+            if (val == PluginConfigParams::NO) {
+                hugePagesMode = HugePagesMode::Disabled;
+            } else if (val == "TRANSPARENT") {
+                hugePagesMode = HugePagesMode::Transparent;
+            } else if (val == "EXPLICIT") {
+                hugePagesMode = HugePagesMode::Explicit;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::huge_pages.name()
+                           << ". Expected only NO/TRANSPARENT/EXPLICIT." << std::endl;
+            }
         } else if (key == CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE) {
             float val_f = 0.0f;
             try {
@@ -197,16 +265,32 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
                     << ". Supported values: bf16, f16, f32";
             }
         } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY == key) {
-            int val_i = -1;
+            long long val_i = -1;
             try {
-                val_i = std::stoi(val);
+                val_i = std::stoll(val);
             } catch (const std::exception&) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
                            << ". Expected only integer numbers";
             }
-            // any negative value will be treated
+            // the capacity is a number of records, any negative value will be treated
             // as zero that means disabling the cache
-            rtCacheCapacity = std::max(val_i, 0);
+            rtCacheCapacity = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_PLAN_CACHE_CAPACITY == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_PLAN_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value is treated as zero that means disabling the cache
+            dynPlanCacheCapacity = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS_POOL == key) {
+            if (val == PluginConfigParams::YES) sharedStreamsPool = true;
+            else if (val == PluginConfigParams::NO) sharedStreamsPool = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS_POOL
+                                   << ". Expected only YES/NO";
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -10,6 +10,7 @@
 #include <openvino/runtime/properties.hpp>
 #include <openvino/util/common_util.hpp>
 #include "utils/debug_caps_config.h"
+#include "memory_allocator.h"
 #include <openvino/core/type/element_type.hpp>
 
 #include <bitset>
@@ -57,11 +58,16 @@ struct Config {
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
 #if defined(OPENVINO_ARCH_X86_64)
+    // maximum number of records of the primitive cache shared by the streams of the compiled model
     size_t rtCacheCapacity = 5000ul;
 #else
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    // byte budget of the shape plans cache of each dynamic graph
+    size_t dynPlanCacheCapacity = 1024ul * 1024ul;
+    // the compiled models share the streams of the process-wide pool
+    bool sharedStreamsPool = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
     bool enableCpuPinning = true;
@@ -69,6 +75,13 @@ struct Config {
     ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
     bool enableHyperThreading = true;
     bool changedHyperThreading = false;
+    bool interOpParallelism = false;
+    bool hybridNodePlacement = false;
+    bool numaLocalActivations = false;
+    bool dynamicMemoryArena = false;
+    size_t stateSlots = 0;
+    size_t latencyBudget = 0;  // microseconds
+    HugePagesMode hugePagesMode = HugePagesMode::Disabled;
     Config::LatencyThreadingMode latencyThreadingMode = Config::LatencyThreadingMode::PER_SOCKET;
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
     LPTransformsMode lpTransformsMode = LPTransformsMode::On;
@@ -3,6 +3,7 @@
 //
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <algorithm>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
@@ -210,20 +211,22 @@ void* MemoryMngrWithReuse::getRawPtr() const noexcept {
 void MemoryMngrWithReuse::setExtBuff(void *ptr, size_t size) {
     m_useExternalStorage = true;
     m_memUpperBound = size;
-    m_data = decltype(m_data)(ptr, release);
+    m_data = decltype(m_data)(ptr, [](void*) {});
 }
 
 bool MemoryMngrWithReuse::resize(size_t size) {
-    constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
+        // the first allocation is exact, the buffer grows geometrically only if the tensor keeps growing
+        if (m_memUpperBound > 0 && m_growthFactor > 1.0f)
+            size = std::max(size, static_cast<size_t>(m_memUpperBound * m_growthFactor));
+        auto data = m_allocator->allocate(size);
+        if (!data) {
             IE_THROW() << "Failed to allocate " << size << " bytes of memory";
         }
         m_memUpperBound = size;
         m_useExternalStorage = false;
-        m_data = decltype(m_data)(ptr, destroy);
+        m_data = std::move(data);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -233,12 +236,6 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
     return m_useExternalStorage;
 }
 
-void MemoryMngrWithReuse::release(void *ptr) {}
-
-void MemoryMngrWithReuse::destroy(void *ptr) {
-    dnnl::impl::free(ptr);
-}
-
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return m_pMemMngr->getRawPtr();
 }
@@ -396,5 +393,12 @@ void StaticMemory::StaticMemoryMngr::registerMemory(Memory* memPtr) {
 void StaticMemory::StaticMemoryMngr::unregisterMemory(Memory* memPtr) {
     //do nothing
 }
+
+MemoryPtr makeWeightsMemory(const dnnl::engine& eng, MemoryDescPtr desc, const MemoryAllocator::Ptr& allocator) {
+    auto mngr = std::make_shared<DnnlMemoryMngr>(
+        make_unique<MemoryMngrWithReuse>(1.0f, allocator ? allocator : MemoryAllocator::getDefault(HugePagesMode::Transparent)));
+    return std::make_shared<Memory>(eng, desc, mngr);
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -12,6 +12,7 @@
 #include <cpu_shape.h>
 
 #include "memory_desc/dnnl_memory_desc.h"
+#include "memory_allocator.h"
 
 #include <string>
 #include <functional>
@@ -72,22 +73,30 @@ public:
 
 /**
  * @brief An implementation of the mem manager where memory reallocation occurs only if a bigger buffer is requested.
+ * With the growth factor greater than one the reallocated buffer is enlarged geometrically, so a tensor which grows
+ * from one inference to another (e.g. the KV cache of a model with dynamic sequence length) is reallocated
+ * a logarithmic number of times instead of every inference.
+ * The buffers are taken from the allocator, which defines their huge pages and NUMA placement.
  */
 class MemoryMngrWithReuse : public IMemoryMngr {
 public:
-    MemoryMngrWithReuse() : m_data(nullptr, release) {}
+    // growth factor used for the memory of the tensors with unbounded dynamic shapes
+    static constexpr float dynamicGrowthFactor = 1.5f;
+
+    explicit MemoryMngrWithReuse(float growthFactor = 1.0f, MemoryAllocator::Ptr allocator = nullptr)
+        : m_growthFactor(growthFactor),
+          m_allocator(allocator ? std::move(allocator) : MemoryAllocator::getDefault()) {}
     void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
 
 private:
+    float m_growthFactor;
+    MemoryAllocator::Ptr m_allocator;
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void *)> m_data;
-
-    static void release(void *ptr);
-    static void destroy(void *ptr);
+    MemoryAllocator::Buffer m_data;
 };
 
 class IMemoryMngrObserver : public IMemoryMngr {
@@ -350,5 +359,12 @@ private:
 using MemoryPtr = std::shared_ptr<IMemory>;
 using MemoryCPtr = std::shared_ptr<const IMemory>;
 
+/**
+ * @brief Creates memory for the weights repacked by the nodes, which live as long as the compiled model.
+ * The large buffers are backed by huge pages to reduce the TLB misses of the kernels streaming the weights,
+ * the transparent ones unless the allocator is given.
+ */
+MemoryPtr makeWeightsMemory(const dnnl::engine& eng, MemoryDescPtr desc, const MemoryAllocator::Ptr& allocator = nullptr);
+
 }   // namespace intel_cpu
 }   // namespace ov
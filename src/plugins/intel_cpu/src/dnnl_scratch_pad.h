@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,16 +17,28 @@ namespace intel_cpu {
 class DnnlScratchPad {
     MemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    // the dynamic nodes sharing the scratch pad may prepare their parameters concurrently
+    std::mutex mutex;
 
 public:
-    DnnlScratchPad(dnnl::engine eng) : eng(eng) {
-        mgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
+    DnnlScratchPad(dnnl::engine eng, MemoryAllocator::Ptr allocator = nullptr) : eng(eng) {
+        mgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>(1.0f, std::move(allocator)));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        std::lock_guard<std::mutex> lock(mutex);
         auto mem = std::make_shared<Memory>(eng, md, mgrPtr);
         return mem;
     }
+
+    /**
+     * @brief Replaces mem with a new memory of the scratch pad, the previous memory is released
+     * under the same lock since it is unregistered from the shared memory manager
+     */
+    void updateScratchPadMem(MemoryPtr& mem, const MemoryDescPtr& md) {
+        std::lock_guard<std::mutex> lock(mutex);
+        mem = std::make_shared<Memory>(eng, md, mgrPtr);
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
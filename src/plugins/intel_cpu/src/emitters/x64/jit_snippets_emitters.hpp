@@ -37,6 +37,9 @@ struct jit_snippets_call_args {
 struct jit_snippets_compile_args {
     std::vector<size_t> master_shape{};
     size_t tile_rank = 0;
+    // the offsets of the data pointers for the outer dimensions are applied by the caller to src_ptrs and dst_ptrs,
+    // so the kernel doesn't depend on the outer dimensions of the shapes and serves all of them
+    bool runtime_data_offsets = false;
 };
 ///
 /// \brief jit_container_emitter designed to wrap Emitters that contain other Emitters (for example, KernelEmitter)
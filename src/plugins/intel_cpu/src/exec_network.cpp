@@ -12,7 +12,10 @@
 #include "memory_state.h"
 #include "itt.h"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 #include "serialize.h"
+#include "compiled_graph_cache.h"
+#include "shared_streams_pool.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
 #include <threading/ie_executor_manager.hpp>
@@ -66,12 +69,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const CompiledGraphCache::CPtr& compiledCache) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _compiledCache(compiledCache) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -84,7 +89,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     if (!core)
         IE_THROW() << "Unable to get API version. Core is unavailable";
     _cfg.isLegacyApi = !core->isNewAPI();
-
+    _paramsCache = GraphContext::createParamsCache(_cfg.rtCacheCapacity);
 
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
@@ -100,7 +105,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (_cfg.sharedStreamsPool && streamsExecutorConfig._streams != 0) {
+            // the model runs on the streams of the pool, but keeps a graph per each of the streams it was configured for
+            auto pool = SharedStreamsPool::get(_plugin->executorManager(), streamsExecutorConfig);
+            _taskExecutor = pool->createExecutor(streamsExecutorConfig._streams);
+        } else {
+            _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
 #endif
     }
     if (0 != cfg.streamExecutorConfig._streams) {
@@ -153,37 +164,67 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, memoryNode->getEngine(), state_store->getDescPtr()));
             }
         }
     }
+
+    if (_cfg.stateSlots > 0) {
+        // the graphs of all the streams have the same variables
+        std::unordered_map<std::string, MemoryDescPtr> variables;
+        auto graphLock = GetGraph();
+        for (auto& node : graphLock._graph.GetNodes()) {
+            if (node->getType() == Type::MemoryInput) {
+                auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
+                if (!memoryNode) {
+                    IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+                }
+                variables[memoryNode->getId()] = memoryNode->getStore()->getDescPtr();
+            }
+        }
+        if (!variables.empty())
+            _stateSlots = std::make_shared<StateSlots>(graphLock._graph.getEngine(), _cfg.stateSlots, variables);
+    }
 }
 
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int socketId = 0;
+    int numaNodeId = -1;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         socketId = streamsExecutor->GetSocketId();
+        if (_cfg.numaLocalActivations)
+            numaNodeId = streamsExecutor->GetNumaNodeId();
     }
     auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
-                GraphContext::Ptr ctx;
+                WeightsSharing::Ptr weightsCache;
+                bool isQuantizedFlag = false;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
-                    auto weightsCache = _cfg.streamExecutorConfig._streams != 1 ? _socketWeights[socketId] : nullptr;
+                    weightsCache = _cfg.streamExecutorConfig._streams != 1 ? _socketWeights[socketId] : nullptr;
 
-                    auto isQuantizedFlag =
+                    isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
-
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
                 }
+
+                // the graphs of the streams are created simultaneously, the executors (primitives, JIT kernels) created by
+                // one of them are found by the others in the params cache of the model, the weights are shared via _socketWeights
+                auto ctx = std::make_shared<GraphContext>(_cfg,
+                                                          extensionManager,
+                                                          weightsCache,
+                                                          isQuantizedFlag,
+                                                          _compiledCache,
+                                                          numaNodeId,
+                                                          _memoryStatistics,
+                                                          _paramsCache);
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
                 exception = std::current_exception();
@@ -301,6 +342,9 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::memory_statistics.name()),
+            RO_property(ov::intel_cpu::queue_statistics.name()),
         };
     }
 
@@ -358,6 +402,46 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        const auto statistics = graph.getGraphContext()->getParamsCache()->getStatistics();
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"evictions", statistics.evictions},
+            {"size", statistics.size},
+            {"capacity", statistics.capacity}};
+    } else if (name == ov::intel_cpu::memory_statistics) {
+        return decltype(ov::intel_cpu::memory_statistics)::value_type{
+            {"allocated", _memoryStatistics->allocated.load()},
+            {"explicit_huge_pages", _memoryStatistics->explicitHugePages.load()},
+            {"transparent_huge_pages", _memoryStatistics->transparentHugePages.load()},
+            {"dynamic_arena_peak_usage", _memoryStatistics->arenaPeakUsage.load()},
+            {"dynamic_arena_fallback_allocations", _memoryStatistics->arenaFallbackAllocations.load()}};
+    } else if (name == ov::intel_cpu::queue_statistics) {
+        decltype(ov::intel_cpu::queue_statistics)::value_type result;
+        const std::pair<ov::hint::Priority, std::string> priorities[] = {{ov::hint::Priority::HIGH, "high"},
+                                                                         {ov::hint::Priority::MEDIUM, "medium"},
+                                                                         {ov::hint::Priority::LOW, "low"}};
+        for (const auto& priority : priorities) {
+            for (const auto* item : {"_depth", "_dispatched", "_total_delay_us", "_max_delay_us"})
+                result[priority.second + item] = 0;
+        }
+        // the queues of the shared pool, of the TBB executor and of the exclusive executor are not tracked
+        if (auto executor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor)) {
+            for (const auto& statistics : executor->GetQueueStatistics()) {
+                const auto priority = std::find_if(std::begin(priorities), std::end(priorities),
+                                                   [&](const std::pair<ov::hint::Priority, std::string>& p) {
+                                                       return p.first == statistics.priority;
+                                                   });
+                if (priority == std::end(priorities))
+                    continue;
+                result[priority->second + "_depth"] = statistics.depth;
+                result[priority->second + "_dispatched"] = statistics.dispatched;
+                result[priority->second + "_total_delay_us"] = statistics.total_delay.count();
+                result[priority->second + "_max_delay_us"] = statistics.max_delay.count();
+            }
+        }
+        return result;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -367,6 +451,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+    // the compiled state follows the IR, so it is skipped by the IR deserializer
+    CompiledGraphCache::serialize(modelStream, GetGraph()._graph);
 }
 
 }   // namespace intel_cpu
@@ -10,11 +10,13 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "memory_state.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -37,7 +39,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const CompiledGraphCache::CPtr& compiledCache = nullptr);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -47,6 +50,14 @@ public:
 
     void Export(std::ostream& modelStream) override;
 
+    /**
+     * @brief Returns the state slots the batched infer requests of a stateful model are bound to,
+     * null if the slots are disabled or the model has no variables
+     */
+    const StateSlots::Ptr& GetStateSlots() const {
+        return _stateSlots;
+    }
+
 protected:
     friend class InferRequestBase;
     ExtensionManager::Ptr extensionManager;
@@ -58,6 +69,14 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // compiled state of the imported model: selected primitives and reordered weights
+    CompiledGraphCache::CPtr                    _compiledCache;
+    // memory held by the buffers of the graphs, shared by their allocators
+    MemoryStatistics::Ptr                       _memoryStatistics = std::make_shared<MemoryStatistics>();
+    // primitive cache shared by the graphs of the streams, never shared with the other compiled models
+    MultiCachePtr                               _paramsCache;
+    // states of the sequences served by the batched infer requests, null if disabled
+    StateSlots::Ptr                             _stateSlots;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -10,9 +10,13 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <iterator>
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -45,6 +49,7 @@
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <openvino/runtime/system_conf.hpp>
 #include <openvino/core/model.hpp>
 #include <openvino/core/node.hpp>
 #include <openvino/op/ops.hpp>
@@ -54,7 +59,7 @@
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
-#   include <tbb/task.h>
+#   include <tbb/task_group.h>
 #endif
 
 using namespace dnnl;
@@ -377,6 +382,9 @@ void Graph::InitGraph() {
 
     Allocate();
 
+    if (!hasDynNodes && getConfig().interOpParallelism)
+        CreateInterOpSchedule();
+
     CreatePrimitivesAndExecConstants();
 
 #ifndef CPU_DEBUG_CAPS
@@ -387,6 +395,18 @@ void Graph::InitGraph() {
 
     ExtractExecutableNodes();
 
+    if (interOpScheduler && !interOpScheduler->covers(executableGraphNodes)) {
+        DEBUG_LOG("Inter-op schedule doesn't match the executable nodes, fallback to sequential execution");
+        interOpScheduler.reset();
+        interOpStreams.clear();
+    }
+
+    if (!hasDynNodes && !interOpScheduler && getConfig().hybridNodePlacement)
+        CreateHybridPlacement();
+
+    if (hasDynNodes)
+        CreateDynamicPlanCache();
+
     status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -463,10 +483,14 @@ void Graph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
+static inline bool isExecutableNode(const NodePtr& node) {
+    return (!node->isConstant() && CPU_DEBUG_CAPS_ALWAYS_TRUE(node->isExecutable())) || node->isDynamicNode();
+}
+
 void Graph::ExtractExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExtractExecutableNodes");
     for (const auto& graphNode : graphNodes) {
-        if ((!graphNode->isConstant() && CPU_DEBUG_CAPS_ALWAYS_TRUE(graphNode->isExecutable())) || graphNode->isDynamicNode()) {
+        if (isExecutableNode(graphNode)) {
             /* @todo
              * Revise implementation.
              * With current way it is possible that with debug_caps enabled
@@ -481,6 +505,118 @@ void Graph::ExtractExecutableNodes() {
     }
 }
 
+bool Graph::ShapesDependOnInputShapesOnly() const {
+    // the nodes whose output data is computed from the constants and the tensor shapes only
+    std::unordered_set<const Node*> shapeDataNodes;
+    for (const auto& node : graphNodes) {
+        bool shapeData = node->isConstant() || node->getType() == Type::ShapeOf;
+        if (!shapeData && !node->getParentEdges().empty()) {
+            shapeData = true;
+            for (size_t i = 0; i < node->getParentEdges().size() && shapeData; i++) {
+                shapeData = shapeDataNodes.count(node->getParentEdgeAt(i)->getParent().get()) != 0;
+            }
+        }
+        if (shapeData)
+            shapeDataNodes.insert(node.get());
+
+        if (node->isDynamicNode()) {
+            const auto portMask = node->shapeInference->get_port_mask();
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                if ((portMask & (1 << i)) && !shapeDataNodes.count(node->getParentEdgeAt(i)->getParent().get()))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+void Graph::CreateDynamicPlanCache() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreateDynamicPlanCache");
+
+    // a plan is valid for any inference with the same input shapes only if no output shape depends on the input data
+    if (!getConfig().dynPlanCacheCapacity || !ShapesDependOnInputShapesOnly())
+        return;
+
+    size_t planSize = sizeof(DynamicPlanCache::Plan) + executableGraphNodes.size() * sizeof(DynamicPlanCache::Dims);
+    for (const auto& node : executableGraphNodes) {
+        if (!node->isDynamicNode())
+            continue;
+        for (const auto& shape : node->outputShapes) {
+            planSize += sizeof(VectorDims) + shape.getRank() * sizeof(Dim);
+        }
+    }
+    for (const auto& input : inputNodesMap) {
+        planSize += sizeof(VectorDims) + input.second->getOutputShapeAtPort(0).getRank() * sizeof(Dim);
+    }
+
+    planCache = std::make_shared<DynamicPlanCache>(getConfig().dynPlanCacheCapacity, planSize);
+    if (!planCache->getCapacity())
+        planCache.reset();
+}
+
+DynamicPlanCache::PlanCPtr Graph::MakeDynamicPlan() const {
+    auto plan = std::make_shared<DynamicPlanCache::Plan>(executableGraphNodes.size());
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto& node = executableGraphNodes[i];
+        if (!node->isDynamicNode())
+            continue;
+        auto& outputDims = (*plan)[i];
+        outputDims.reserve(node->outputShapes.size());
+        for (size_t port = 0; port < node->outputShapes.size(); port++) {
+            outputDims.push_back(node->getChildEdgesAtPort(port)[0]->getMemory().getStaticDims());
+        }
+    }
+    return plan;
+}
+
+void Graph::CreateInterOpSchedule() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreateInterOpSchedule");
+
+    std::vector<NodePtr> nodes;
+    std::copy_if(graphNodes.begin(), graphNodes.end(), std::back_inserter(nodes), isExecutableNode);
+
+    auto scheduler = std::make_shared<InterOpScheduler>(nodes, context->getNumScratchPads(), parallel_get_max_threads());
+    if (!scheduler->hasParallelWaves())
+        return;
+
+    // the nodes of a wave are executed simultaneously, so each of them gets the scratch pad and the stream of its lane.
+    // The scratch pads must be bound before the primitives are created.
+    int numLanes = 1;
+    for (const auto& wave : scheduler->getWaves()) {
+        for (const auto& task : wave) {
+            task.node->scratchpadLane = task.lane;
+            numLanes = std::max(numLanes, task.lane + 1);
+        }
+    }
+    for (int i = 0; i < numLanes; i++) {
+        interOpStreams.emplace_back(getEngine());
+    }
+    interOpScheduler = scheduler;
+}
+
+void Graph::CreateHybridPlacement() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreateHybridPlacement");
+
+    // the streams of a multi-stream configuration are already placed on the core types,
+    // a single stream spans all the cores unless the scheduling core type restricts them
+    const auto& config = getConfig();
+    if (config.streamExecutorConfig._streams != 1 ||
+        config.schedulingCoreType != ov::hint::SchedulingCoreType::ANY_CORE)
+        return;
+
+    auto placement = std::make_shared<HybridNodePlacement>(ov::get_proc_type_table(), config.enableHyperThreading);
+    if (!placement->isHybrid())
+        return;
+
+    placement->place(executableGraphNodes);
+    // if all the nodes are of the same class, the stream arena spanning both core types serves them better
+    if (placement->getSegments().size() < 2)
+        return;
+
+    DEBUG_LOG("Hybrid placement with ", placement->getSegments().size(), " segments");
+    hybridPlacement = placement;
+}
+
 void Graph::CreatePrimitivesAndExecConstants() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     dnnl::stream stream(getEngine());
@@ -750,6 +886,7 @@ void Graph::AllocateWithReuse() {
 
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
+    std::unordered_set<int64_t> ioBoxes;
     for (size_t i = 0; i < remaining_edge_clusters_count; i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i) };
         int64_t boxSize = 0;
@@ -794,13 +931,17 @@ void Graph::AllocateWithReuse() {
         } else {
             box.size = boxSize;
             undefinedBoxes.push_back(box);
+            if (isInput || isOutput)
+                ioBoxes.insert(box.id);
         }
     }
 
     MemorySolver staticMemSolver(definedBoxes);
     size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<Memory>(getEngine(), DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    memWorkspace = std::make_shared<Memory>(getEngine(),
+                                            DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})),
+                                            context->createActivationMemoryMngr());
 
     if (edge_clusters.empty())
         return;
@@ -906,9 +1047,18 @@ void Graph::AllocateWithReuse() {
                 groups.push_back({box});
             }
         }
+        if (getConfig().dynamicMemoryArena)
+            dynamicArena = std::make_shared<DynamicMemoryArena>(context->getMemoryAllocator());
+
         for (auto& group : groups) {
-            auto grpMemMngr =
-                std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
+            // the data of the inputs and the outputs lives across the inferences, while the arena is relaid out
+            // between them, so only the groups of the intermediate tensors are placed in the arena
+            const bool intermediate = std::none_of(group.begin(), group.end(), [&](const MemorySolver::Box& box) {
+                return ioBoxes.count(box.id);
+            });
+            auto grpMemMngr = dynamicArena && intermediate
+                                  ? dynamicArena->createMemoryMngr()
+                                  : context->createActivationMemoryMngr(MemoryMngrWithReuse::dynamicGrowthFactor);
             for (auto& box : group) {
                 for (auto& edge : edge_clusters[box.id]) {
                     if (edge->getStatus() == Edge::Status::NeedAllocation) {
@@ -1119,19 +1269,62 @@ void Graph::PullOutputData(BlobMap &out) {
     }
 }
 
-void Graph::InferStatic(InferRequestBase* request) {
+void Graph::InferStatic() {
+    if (interOpScheduler) {
+        InferStaticInterOp();
+        return;
+    }
+    if (hybridPlacement) {
+        InferStaticHybrid();
+        return;
+    }
+
     dnnl::stream stream(getEngine());
+    const auto& checkpoint = *context->getInferCheckpoint();
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
+        checkpoint.check();
         ExecuteNode(node, stream);
     }
 }
 
+void Graph::InferStaticInterOp() {
+    const auto& waves = interOpScheduler->getWaves();
+    const auto& checkpoint = *context->getInferCheckpoint();
+    for (size_t i = 0; i < waves.size(); i++) {
+        checkpoint.check();
+
+        interOpScheduler->run(i, [&](const InterOpScheduler::Task& task) {
+            const auto& node = task.node;
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+
+            ExecuteNode(node, interOpStreams[task.lane]);
+        });
+    }
+}
+
+void Graph::InferStaticHybrid() {
+    dnnl::stream stream(getEngine());
+    const auto& checkpoint = *context->getInferCheckpoint();
+
+    for (const auto& segment : hybridPlacement->getSegments()) {
+        hybridPlacement->run(segment.coreType, [&] {
+            for (size_t i = segment.begin; i < segment.end; i++) {
+                const auto& node = executableGraphNodes[i];
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, getConfig().collectPerfCounters);
+
+                checkpoint.check();
+                ExecuteNode(node, stream);
+            }
+        });
+    }
+}
+
 namespace {
 
 class IUpdateNodes {
@@ -1140,14 +1333,25 @@ public:
     virtual ~IUpdateNodes() = default;
 };
 
+// the output shapes are either inferred or taken from the plan made for the same input shapes
+inline void updateNodeShapes(const NodePtr& node, const DynamicPlanCache::Plan* plan, size_t indx) {
+    if (plan) {
+        node->redefineOutputMemory((*plan)[indx]);
+    } else {
+        node->updateShapes();
+    }
+}
+
 class UpdateNodesSeq : public IUpdateNodes {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, const DynamicPlanCache::Plan* plan, bool collectPerfCounters)
+        : m_executableGraphNodes(executableGraphNodes), m_plan(plan), m_collectPerfCounters(collectPerfCounters) {}
     void run(size_t stopIndx) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                updateNodeShapes(node, m_plan, prepareCounter);
+                PERF_PREPARE(node, m_collectPerfCounters);
                 node->updateDynamicParams();
             }
         }
@@ -1156,6 +1360,8 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    const DynamicPlanCache::Plan* m_plan;
+    bool m_collectPerfCounters;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1163,162 +1369,136 @@ private:
 #endif
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
+/**
+ * The shapes are inferred by a single thread in the topological order, since the output shapes of a node
+ * are computed from the output shapes of its parents. The parameters of a node depend only on its own shapes,
+ * so as soon as the shapes of a node are known its prepareParams may run concurrently with the parameters
+ * preparation of any other node. The nodes are claimed by the preparing threads one by one in the execution order,
+ * a thread which claimed a node whose shapes are not inferred yet sleeps until they are.
+ */
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
-    void updateShapes(size_t node_indx, size_t stop_indx) {
+    UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, const DynamicPlanCache::Plan* plan, bool collectPerfCounters)
+        : m_executableGraphNodes(executableGraphNodes), m_plan(plan), m_collectPerfCounters(collectPerfCounters) {}
+
+protected:
+    void start(size_t stopIndx) {
+        m_paramsCounter.store(m_shapesCounter.load());
+        m_stopIndx = stopIndx;
+        m_failed = false;
+        m_exception = nullptr;
+    }
+
+    void updateShapes() {
         try {
-            for (size_t i = node_indx; i < stop_indx; i++) {
+            for (size_t i = m_shapesCounter.load(std::memory_order_relaxed); i < m_stopIndx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    updateNodeShapes(node, m_plan, i);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_shapesCounter.store(i + 1, std::memory_order_release);
                 }
-                m_prepareCounter.store(i, std::memory_order::memory_order_release);
+                m_ready.notify_all();
             }
+        } catch (...) {
+            fail(std::current_exception());
         }
-        catch(...) {
-            m_completion.store(true, std::memory_order::memory_order_relaxed);
-            throw;
-        }
-        m_prepareCounter.store(stop_indx, std::memory_order::memory_order_relaxed);
-        m_completion.store(true, std::memory_order::memory_order_release);
     }
 
-    void updateDynParams(size_t node_indx, size_t /*unused*/) {
-        size_t local_counter = node_indx;
-        while (true) {
-            const bool completion = m_completion.load(std::memory_order::memory_order_acquire);
-            const size_t prepareCounter = m_prepareCounter.load(std::memory_order::memory_order_relaxed);
-            if (completion && local_counter == prepareCounter) {
-                break;
-            }
-            while (local_counter < prepareCounter) {
-                const auto& node = m_executableGraphNodes[local_counter++];
+    void updateDynParams() {
+        try {
+            for (size_t i = m_paramsCounter.fetch_add(1); i < m_stopIndx; i = m_paramsCounter.fetch_add(1)) {
+                if (m_shapesCounter.load(std::memory_order_acquire) <= i) {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_ready.wait(lock, [&] {
+                        return m_failed || m_shapesCounter.load(std::memory_order_relaxed) > i;
+                    });
+                }
+                if (m_failed)
+                    return;
+                const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
+                    PERF_PREPARE(node, m_collectPerfCounters);
                     node->updateDynamicParams();
                 }
             }
+        } catch (...) {
+            fail(std::current_exception());
         }
     }
 
-protected:
-    std::atomic<size_t> m_prepareCounter{0};
-    std::atomic<bool> m_completion{false};
-    std::vector<NodePtr>& m_executableGraphNodes;
-};
-
-#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
-#if (TBB_VERSION_MAJOR > 2020)
-template <typename Body>
-class AsyncTask : public tbb::detail::d1::task {
-public:
-    AsyncTask(Body& body, tbb::detail::d1::wait_context& wait, size_t node_indx, size_t stop_indx) :
-        m_body(body), m_wait(wait), m_node_indx(node_indx), m_stop_indx(stop_indx) {}
-    task* execute(tbb::detail::d1::execution_data&) override {
-        m_body(m_node_indx, m_stop_indx);
-        m_wait.release();
-        return nullptr;
-    }
-    task* cancel(tbb::detail::d1::execution_data&) override {
-        m_wait.release();
-        return nullptr;
+    void rethrow() {
+        if (m_exception)
+            std::rethrow_exception(m_exception);
     }
 
-private:
-    Body& m_body;
-    tbb::detail::d1::wait_context& m_wait;
-    size_t m_node_indx;
-    size_t m_stop_indx;
-};
-
-class UpdateNodes : public UpdateNodesBase {
-public:
-    using UpdateNodesBase::UpdateNodesBase;
-    void run(size_t stopIndx) override {
-        m_completion.store(false);
-        auto startCounter = m_prepareCounter.load();
-        tbb::detail::d1::wait_context wait_ctx(2);
-
-        auto task1 = [this](size_t start, size_t stop) {
-            this->updateShapes(start, stop);
-        };
-        AsyncTask<decltype(task1)> t1(task1, wait_ctx, startCounter, stopIndx);
-
-        auto task2 = [this](size_t start, size_t stop) {
-            this->updateDynParams(start, stop);
-        };
-        AsyncTask<decltype(task2)> t2(task2, wait_ctx, startCounter, stopIndx);
-
-        tbb::detail::d1::spawn(t2, ctx, /* always submit the task to a thread that occupies the first slot */ 1);
-        tbb::detail::d1::execute_and_wait(t1, ctx, wait_ctx, ctx);
+    size_t preparingThreads() const {
+        // no more threads than the nodes to prepare, the calling thread takes part as well
+        const size_t nodesCount = m_stopIndx - m_shapesCounter.load();
+        return std::max<size_t>(1, std::min(static_cast<size_t>(parallel_get_max_threads()), nodesCount));
     }
 
 private:
-    tbb::task_group_context ctx;
-};
-#else
-template <typename Body>
-class AsyncTask : public tbb::task {
-public:
-    AsyncTask(Body& body, size_t node_indx, size_t stop_indx) : m_body(body), m_node_indx(node_indx), m_stop_indx(stop_indx) {}
-    task* execute() override {
-        m_body(m_node_indx, m_stop_indx);
-        return nullptr;
+    void fail(std::exception_ptr exception) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+                m_exception = exception;
+            m_failed = true;
+        }
+        m_ready.notify_all();
     }
 
-private:
-    Body& m_body;
-    size_t m_node_indx;
-    size_t m_stop_indx;
+    std::vector<NodePtr>& m_executableGraphNodes;
+    const DynamicPlanCache::Plan* m_plan;
+    bool m_collectPerfCounters;
+    size_t m_stopIndx = 0;
+    std::atomic<size_t> m_shapesCounter{0};
+    std::atomic<size_t> m_paramsCounter{0};
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::atomic<bool> m_failed{false};
+    std::exception_ptr m_exception;
 };
 
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 class UpdateNodes : public UpdateNodesBase {
 public:
     using UpdateNodesBase::UpdateNodesBase;
     void run(size_t stopIndx) override {
-        m_completion.store(false);
-        auto startCounter = m_prepareCounter.load();
-        tbb::task& root = *new(tbb::task::allocate_root()) tbb::empty_task;
-        root.set_ref_count(3); // two for children and one preserved
-
-        auto task1 = [this](size_t start, size_t stop) {
-            this->updateShapes(start, stop);
-        };
-        AsyncTask<decltype(task1)>& a = *new (root.allocate_child()) AsyncTask<decltype(task1)>(task1, startCounter, stopIndx);
-
-        auto task2 = [this](size_t start, size_t stop) {
-            this->updateDynParams(start, stop);
-        };
-        AsyncTask<decltype(task2)>& b = *new (root.allocate_child()) AsyncTask<decltype(task2)>(task2, startCounter, stopIndx);
-
-        b.set_affinity(2); // slot 1 plus 1
-        tbb::task::spawn(b);
-        root.spawn_and_wait_for_all(a);
+        start(stopIndx);
+        // the helpers are spawned to the arena of the current stream, the calling thread infers the shapes
+        // and then joins the parameters preparation, so the progress doesn't depend on the helpers being scheduled
+        tbb::task_group group;
+        for (size_t i = 1; i < preparingThreads(); i++) {
+            group.run([this] {
+                updateDynParams();
+            });
+        }
+        updateShapes();
+        updateDynParams();
+        group.wait();
+        rethrow();
     }
 };
 #endif
-#endif
 
 #if (OV_THREAD == OV_THREAD_OMP)
 class UpdateNodes : public UpdateNodesBase {
 public:
     using UpdateNodesBase::UpdateNodesBase;
     void run(size_t stopIndx) override {
-        m_completion.store(false);
-        auto startCounter = m_prepareCounter.load();
+        start(stopIndx);
 
-        #pragma omp parallel
-        #pragma omp sections
+        #pragma omp parallel num_threads(static_cast<int>(preparingThreads()))
         {
-            #pragma omp section
-            {
-                updateDynParams(startCounter, stopIndx);
-            }
-            #pragma omp section
-            {
-                updateShapes(startCounter, stopIndx);
-            }
+            if (omp_get_thread_num() == 0)
+                updateShapes();
+            updateDynParams();
         }
+        rethrow();
     }
 };
 #endif
@@ -1327,8 +1507,9 @@ public:
 } // namespace
 
 
-void Graph::InferDynamic(InferRequestBase* request) {
+void Graph::InferDynamic() {
     dnnl::stream stream(getEngine());
+    const auto& checkpoint = *context->getInferCheckpoint();
 
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
@@ -1339,11 +1520,21 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    DynamicPlanCache::Dims inputDims;
+    DynamicPlanCache::PlanCPtr plan;
+    if (planCache) {
+        inputDims.reserve(inputNodesMap.size());
+        for (const auto& input : inputNodesMap) {
+            inputDims.push_back(input.second->getChildEdgeAt(0)->getMemory().getStaticDims());
+        }
+        plan = planCache->find(inputDims);
+    }
+
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, plan.get(), getConfig().collectPerfCounters));
     } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, plan.get(), getConfig().collectPerfCounters));
     }
     size_t inferCounter = 0;
 
@@ -1354,11 +1545,18 @@ void Graph::InferDynamic(InferRequestBase* request) {
             VERBOSE(node, getConfig().debugCaps.verbose);
             PERF(node, getConfig().collectPerfCounters);
 
-            if (request)
-                request->ThrowIfCanceled();
+            checkpoint.check();
             ExecuteNode(node, stream);
         }
     }
+
+    if (planCache && !plan) {
+        planCache->add(inputDims, MakeDynamicPlan());
+    }
+
+    // the intermediate tensors are dead now, the buffers allocated aside the arena are moved into it
+    if (dynamicArena)
+        dynamicArena->reset();
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1373,15 +1571,15 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     }
 }
 
-void Graph::Infer(InferRequestBase* request) {
+void Graph::Infer() {
     if (!IsReady()) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
     if (Status::ReadyDynamic == status) {
-        InferDynamic(request);
+        InferDynamic();
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        InferStatic();
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
@@ -1492,6 +1690,14 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
         node->typeStr.copy(pc.layer_type, layerTypeLen, 0);
 
+        // prepareParams() of the dynamic nodes runs ahead of the execution, it is reported as a separate entry
+        if (node->PerfPrepareCounter().count()) {
+            InferenceEngine::InferenceEngineProfileInfo &prepare = perfMap[node->getName() + "_prepareParams"];
+            prepare = pc;
+            prepare.cpu_uSec = prepare.realTime_uSec = (long long) node->PerfPrepareCounter().avg();
+            prepare.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+        }
+
         for (auto& fusedNode : node->fusedWith) {
             getPerfMapFor(perfMap, fusedNode);
         }
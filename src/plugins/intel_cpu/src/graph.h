@@ -7,12 +7,16 @@
 #include "cpp/ie_cnn_network.h"
 #include "config.h"
 #include "cpu_memory.h"
+#include "arena_mem_mgr.h"
 #include "normalize_preprocess.h"
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/dynamic_plan_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "hybrid_node_placement.h"
+#include "inter_op_scheduler.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -63,7 +67,7 @@ public:
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(InferRequestBase* request = nullptr);
+    void Infer();
 
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
@@ -206,6 +210,11 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        interOpScheduler.reset();
+        interOpStreams.clear();
+        hybridPlacement.reset();
+        planCache.reset();
+        dynamicArena.reset();
     }
     Status status { Status::NotReady };
 
@@ -237,10 +246,17 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
+    void CreateInterOpSchedule();
+    void CreateHybridPlacement();
+    bool ShapesDependOnInputShapesOnly() const;
+    void CreateDynamicPlanCache();
+    DynamicPlanCache::PlanCPtr MakeDynamicPlan() const;
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
-    void InferStatic(InferRequestBase* request);
-    void InferDynamic(InferRequestBase* request);
+    void InferStatic();
+    void InferStaticInterOp();
+    void InferStaticHybrid();
+    void InferDynamic();
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -261,6 +277,19 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // execution plan for the inter-op parallel mode, null if the graph is executed sequentially
+    InterOpScheduler::Ptr interOpScheduler;
+    std::vector<dnnl::stream> interOpStreams;
+
+    // placement of the nodes on the core types of a hybrid CPU, null if the graph is executed on the stream arena
+    HybridNodePlacement::Ptr hybridPlacement;
+
+    // shape plans of the dynamic graph keyed by the input shapes, null if the shapes depend on the input data
+    DynamicPlanCache::Ptr planCache;
+
+    // arena of the intermediate dynamic tensors, null if they are allocated by their memory managers
+    DynamicMemoryArena::Ptr dynamicArena;
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
@@ -9,5 +9,16 @@ namespace intel_cpu {
 
 dnnl::engine GraphContext::eng(dnnl::engine::kind::cpu, 0);
 
+MultiCachePtr GraphContext::createParamsCache(size_t capacity) {
+    // the number of independently locked parts of the cache, it's enough to make the contention negligible
+    // for any reasonable number of streams
+    static constexpr size_t numShards = 32;
+
+    if (capacity == 0)
+        return std::make_shared<MultiCache>(0);
+
+    return std::make_shared<MultiCache>(capacity, numShards);
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include "ie_parallel.hpp"
 #include "cache/multi_cache.h"
+#include "compiled_graph_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
+#include "infer_checkpoint.h"
 #include "weights_cache.hpp"
 
 namespace ov {
@@ -21,13 +24,29 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 CompiledGraphCache::CPtr compiledCache = nullptr,
+                 int numaNodeId = -1,
+                 MemoryStatistics::Ptr memoryStatistics = nullptr,
+                 MultiCachePtr paramsCache = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          compiledCache(compiledCache),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+        rtParamsCache = paramsCache ? paramsCache : createParamsCache(config.rtCacheCapacity);
+        memoryAllocator = std::make_shared<MemoryAllocator>(config.hugePagesMode, numaNodeId, memoryStatistics);
+        // the repacked weights are backed by the transparent huge pages unless the explicit ones are requested
+        weightsAllocator = std::make_shared<MemoryAllocator>(
+            config.hugePagesMode == HugePagesMode::Explicit ? HugePagesMode::Explicit : HugePagesMode::Transparent,
+            numaNodeId,
+            memoryStatistics);
+        // nodes executed simultaneously by the inter-op scheduler must not share the scratch pad,
+        // so one scratch pad per inter-op lane is created
+        const int numScratchPads = config.interOpParallelism ? std::max(1, parallel_get_max_threads()) : 1;
+        for (int i = 0; i < numScratchPads; i++) {
+            rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(eng, memoryAllocator));
+        }
     }
 
     const Config& getConfig() const {
@@ -42,16 +61,23 @@ public:
         return weightsCache;
     }
 
+    CompiledGraphCache::CPtr getCompiledCache() const {
+        return compiledCache;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
 
-    DnnlScratchPadPtr getScratchPad() const {
-        return rtScratchPad;
+    DnnlScratchPadPtr getScratchPad(int lane = 0) const {
+        return rtScratchPads[lane];
+    }
+
+    int getNumScratchPads() const {
+        return static_cast<int>(rtScratchPads.size());
     }
 
-    dnnl::engine getEngine() const {
+    static dnnl::engine getEngine() {
         return eng;
     }
 
@@ -59,16 +85,63 @@ public:
         return isGraphQuantizedFlag;
     }
 
+    /**
+     * @brief Returns the NUMA node the activations of the graph are placed on, -1 if they follow the default policy
+     */
+    int getNumaNodeId() const {
+        return memoryAllocator->getNumaNodeId();
+    }
+
+    /**
+     * @brief Creates a memory manager for the activations of the graph
+     * @param growthFactor growth factor of the buffer, see MemoryMngrWithReuse
+     */
+    MemoryMngrPtr createActivationMemoryMngr(float growthFactor = 1.0f) const {
+        return std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>(growthFactor, memoryAllocator));
+    }
+
+    /**
+     * @brief Returns the allocator of the activations of the graph
+     */
+    const MemoryAllocator::Ptr& getMemoryAllocator() const {
+        return memoryAllocator;
+    }
+
+    /**
+     * @brief Returns the allocator of the weights repacked by the nodes of the graph
+     */
+    const MemoryAllocator::Ptr& getWeightsAllocator() const {
+        return weightsAllocator;
+    }
+
+    /**
+     * @brief Returns the cancellation and deadline checkpoint of the inference running on the graph
+     */
+    const InferCheckpoint::Ptr& getInferCheckpoint() const {
+        return inferCheckpoint;
+    }
+
+    /**
+     * @brief Creates the primitive cache which may be shared by the graphs of the streams of one compiled model
+     * @param capacity maximum number of records of the cache, zero capacity means the cache is disabled
+     */
+    static MultiCachePtr createParamsCache(size_t capacity);
+
 private:
     Config config;  // network-level config
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    CompiledGraphCache::CPtr compiledCache;   // compiled state of the imported model, if any
 
-    MultiCachePtr rtParamsCache;     // primitive cache
-    DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    MultiCachePtr rtParamsCache;     // primitive cache (shared by the graphs of the compiled model)
+    std::vector<DnnlScratchPadPtr> rtScratchPads;  // scratch pads, one per inter-op lane
 
     bool isGraphQuantizedFlag = false;
+    // allocators bound to the NUMA node of the stream owning the graph, if the activations are NUMA local
+    MemoryAllocator::Ptr memoryAllocator;
+    MemoryAllocator::Ptr weightsAllocator;
+    InferCheckpoint::Ptr inferCheckpoint = std::make_shared<InferCheckpoint>();
     static dnnl::engine eng;  // onednn engine (singleton)
 };
 
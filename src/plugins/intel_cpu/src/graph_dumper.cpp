@@ -162,6 +162,9 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
         }
 
         auto meta_data = extract_node_metadata(node);
+        // the nodes of a wave executed simultaneously get the different lanes
+        if (graph.interOpScheduler)
+            meta_data["interOpLane"] = std::to_string(node->getScratchpadLane());
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
@@ -22,6 +22,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -79,6 +80,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseFCAndWeightsDecompression(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndTableDecompression");
+    FuseEmbeddingBagAndTableDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
@@ -286,7 +291,8 @@ void GraphOptimizer::FuseConvMatmulFCDeconvAndDQScales(Graph &graph) {
 }
 
 void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
-    const std::set<InferenceEngine::Precision> supportedWeightsPrecisions{InferenceEngine::Precision::U8};
+    const std::set<InferenceEngine::Precision> supportedWeightsPrecisions{InferenceEngine::Precision::U8, InferenceEngine::Precision::U4,
+                                                                          InferenceEngine::Precision::I4};
     const std::set<InferenceEngine::Precision> supportedDataPrecisions{InferenceEngine::Precision::FP32, InferenceEngine::Precision::BF16};
     auto expectedNode = [](NodePtr node, Type expectedType) {
         return node->getType() == expectedType && node->getChildEdges().size() == 1;
@@ -304,8 +310,11 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         const auto parent = fcNode->getParentEdgesAtPort(1)[0]->getParent();
         const bool withTranspose = parent->getType() == Type::Transpose;
         const NodePtr transposeNode = withTranspose ? parent : nullptr;
+        // group-wise decompression: [OC, G, GS] weights are decompressed with [OC, G, 1] parameters and reshaped to [OC, IC]
+        const bool withReshape = expectedNode(parent, Type::Reshape);
+        const NodePtr reshapeNode = withReshape ? parent : nullptr;
 
-        const auto multiplyNode = withTranspose ? parent->getParentEdgesAtPort(0)[0]->getParent() : parent;
+        const auto multiplyNode = (withTranspose || withReshape) ? parent->getParentEdgesAtPort(0)[0]->getParent() : parent;
         if (!expectedNode(multiplyNode, Type::Eltwise) || multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply ||
             !multiplyNode->isConstant())
             continue;
@@ -341,7 +350,8 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
             continue;
         if (supportedDataPrecisions.find(fcNode->getOriginalInputPrecisionAtPort(0)) == supportedDataPrecisions.end())
             continue;
-        if (supportedWeightsPrecisions.find(weightsNode->getOriginalOutputPrecisionAtPort(0)) == supportedWeightsPrecisions.end())
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (supportedWeightsPrecisions.find(weightsPrecision) == supportedWeightsPrecisions.end())
             continue;
 
         // Shape limitations
@@ -350,19 +360,34 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         if (weightsShape != fcInputWeightsShape)
             continue;
 
-        const auto expectedDims = withTranspose ? VectorDims{1, weightsShape.getDims()[1]}
-                                                 : VectorDims{weightsShape.getDims()[0], 1};
+        if (withReshape && (weightsShape.getRank() != 3 || fcNode->getInputShapeAtPort(1).getRank() != 2))
+            continue;
+
+        const auto& weightsDims = weightsShape.getDims();
+        const auto expectedDims = withReshape ? VectorDims{weightsDims[0], weightsDims[1], 1} :
+                                  withTranspose ? VectorDims{1, weightsDims[1]}
+                                                : VectorDims{weightsDims[0], 1};
         if (multiplyConstNode->getOutputShapeAtPort(0).getDims() != expectedDims)
             continue;
         if (withSubtract && subtractConstNode->getOutputShapeAtPort(0).getDims() != expectedDims)
             continue;
 
+        // oneDNN decompresses only u8 per-channel weights, the 4-bit weights (per-channel or group-wise) are decompressed by
+        // the FullyConnected node itself, which doesn't support the transposed ones
+        const bool groupWise = withReshape && weightsDims[0] * weightsDims[1] > fcNode->getInputShapeAtPort(1).getDims()[0];
+        const bool int4Weights = one_of(weightsPrecision, Precision::U4, Precision::I4);
+        if (int4Weights && withTranspose)
+            continue;
+        if (groupWise && !int4Weights)
+            continue;
+
         // HW specific shape limitations
-        if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_amx)) {
+        if (!int4Weights && impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_amx)) {
             // OneDNN AMX IP implementation has limited shapes support due to performance considerations. As a current solution conditions below are copied
             // from OneDNN to make sure correct IP impl will be used since fallback one doesn't support weights decompression feature.
-            size_t OC = withTranspose ? weightsShape.getDims()[1] : weightsShape.getDims()[0];
-            size_t IC = withTranspose ? weightsShape.getDims()[0] : weightsShape.getDims()[1];
+            const auto& fcWeightsDims = fcNode->getInputShapeAtPort(1).getDims();
+            size_t OC = withReshape ? fcWeightsDims[0] : withTranspose ? weightsDims[1] : weightsDims[0];
+            size_t IC = withReshape ? fcWeightsDims[1] : withTranspose ? weightsDims[0] : weightsDims[1];
             size_t simdWidth = 16;
             size_t vnniFactor = 2;
             size_t maxSize = 512;
@@ -393,15 +418,112 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
             graph.DropNode(subtractNode);
         graph.DropNode(multiplyNode);
 
-        const auto& weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
         if (withTranspose) {
             transposeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
             transposeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
         }
+        if (withReshape) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
         fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndTableDecompression(Graph &graph) {
+    const std::set<InferenceEngine::Precision> supportedTablePrecisions{InferenceEngine::Precision::U8, InferenceEngine::Precision::I8};
+    auto expectedNode = [](NodePtr node, Type expectedType) {
+        return node->getType() == expectedType && node->getChildEdges().size() == 1;
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& embeddingNode = graphNodes[i];
+        const auto embeddingBag = dynamic_cast<node::EmbeddingBagSum*>(embeddingNode.get());
+        if (embeddingBag == nullptr)
+            continue;
+
+        const auto multiplyNode = embeddingNode->getParentEdgesAtPort(0)[0]->getParent();
+        if (!expectedNode(multiplyNode, Type::Eltwise) || multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply ||
+            !multiplyNode->isConstant())
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndTableDecompression);
+        const auto multiplyConstNode = multiplyNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (!expectedNode(multiplyConstNode, Type::Input))
+            continue;
+
+        const auto mulParent = multiplyNode->getParentEdgesAtPort(0)[0]->getParent();
+        const bool withSubtract = mulParent->getAlgorithm() == Algorithm::EltwiseSubtract;
+        NodePtr subtractNode, subtractConstNode;
+        if (withSubtract) {
+            subtractNode = mulParent;
+            if (!expectedNode(subtractNode, Type::Eltwise))
+                continue;
+            subtractConstNode = subtractNode->getParentEdgesAtPort(1)[0]->getParent();
+            if (!expectedNode(subtractConstNode, Type::Input))
+                continue;
+        }
+
+        const auto convertNode = withSubtract ? subtractNode->getParentEdgesAtPort(0)[0]->getParent() : mulParent;
+        if (!expectedNode(convertNode, Type::Convert))
+            continue;
+        const auto tableNode = convertNode->getParentEdgesAtPort(0)[0]->getParent();
+        if (!expectedNode(tableNode, Type::Input))
+            continue;
+
+        // Precision limitations
+        if (multiplyConstNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        if (withSubtract && subtractConstNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        if (!one_of(embeddingNode->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+            continue;
+        const auto tablePrecision = tableNode->getOriginalOutputPrecisionAtPort(0);
+        if (supportedTablePrecisions.find(tablePrecision) == supportedTablePrecisions.end())
+            continue;
+
+        // Shape limitations: the decompression parameters are per row or per tensor
+        const auto tableShape = tableNode->getOutputShapeAtPort(0);
+        if (!tableShape.isStatic() || tableShape != multiplyNode->getOutputShapeAtPort(0))
+            continue;
+        const auto& tableDims = tableShape.getStaticDims();
+        auto isRowWise = [&tableDims](const NodePtr& constNode) {
+            const auto& constShape = constNode->getOutputShapeAtPort(0);
+            if (constShape.getElementsCount() == 1)
+                return true;
+            const auto& constDims = constShape.getDims();
+            return constDims.size() == tableDims.size() && constDims[0] == tableDims[0] &&
+                   constShape.getElementsCount() == tableDims[0];
+        };
+        if (!isRowWise(multiplyConstNode) || (withSubtract && !isRowWise(subtractConstNode)))
+            continue;
+
+        // Fusion processing
+        embeddingBag->fuseDecompressionMultiply(multiplyConstNode);
+        if (withSubtract)
+            embeddingBag->fuseDecompressionSubtract(subtractConstNode);
+
+        embeddingNode->addOriginalLayer(multiplyNode->getOriginalLayers());
+        embeddingNode->addOriginalLayer(convertNode->getOriginalLayers());
+
+        if (withSubtract) {
+            embeddingNode->addOriginalLayer(subtractNode->getOriginalLayers());
+            auto subtractConstEdge = subtractConstNode->getChildEdges()[0].lock();
+            graph.RemoveEdge(subtractConstEdge);
+        }
+        auto multiplyConstEdge = multiplyConstNode->getChildEdges()[0].lock();
+        graph.RemoveEdge(multiplyConstEdge);
+
+        graph.DropNode(convertNode);
+        if (withSubtract)
+            graph.DropNode(subtractNode);
+        graph.DropNode(multiplyNode);
+
+        embeddingNode->setOriginalInputPrecisionAtPort(0, tablePrecision);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hybrid_node_placement.h"
+
+#include <algorithm>
+
+#include "edge.h"
+#include "ie_parallel.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/threading/cpu_streams_info.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov {
+namespace intel_cpu {
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+namespace {
+
+std::shared_ptr<ov::threading::IStreamsExecutor> makeSubArena(const std::string& name,
+                                                               int procType,
+                                                               int threads,
+                                                               const std::vector<int>& procTypes) {
+    ov::threading::IStreamsExecutor::Config config{name, 1, threads};
+    // the streams info table makes the stream arena constrained by the core type on a hybrid CPU
+    config._streams_info_table = {{1, procType, threads, procTypes[PROC_NUMA_NODE_ID], procTypes[PROC_SOCKET_ID]}};
+    return std::make_shared<ov::threading::CPUStreamsExecutor>(config);
+}
+
+}   // namespace
+#endif
+
+HybridNodePlacement::HybridNodePlacement(const std::vector<std::vector<int>>& procTypeTable, bool useHyperThreading) {
+    if (procTypeTable.empty() || procTypeTable[0].size() < PROC_TYPE_TABLE_SIZE)
+        return;
+
+    // the first row describes all the processors available to the process
+    const auto& procTypes = procTypeTable[0];
+    performanceThreads = procTypes[MAIN_CORE_PROC] + (useHyperThreading ? procTypes[HYPER_THREADING_PROC] : 0);
+    efficientThreads = procTypes[EFFICIENT_CORE_PROC];
+    if (!isHybrid())
+        return;
+
+    // the hyper-threading processor type lets the arena occupy both logical cores of a Performance-core
+    const auto performanceProcType =
+        useHyperThreading && procTypes[HYPER_THREADING_PROC] > 0 ? HYPER_THREADING_PROC : MAIN_CORE_PROC;
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    subArenas.resize(2);
+    subArenas[static_cast<size_t>(CoreType::Performance)] =
+        makeSubArena("CPUHybridPerformanceCores", performanceProcType, performanceThreads, procTypes);
+    subArenas[static_cast<size_t>(CoreType::Efficient)] =
+        makeSubArena("CPUHybridEfficientCores", EFFICIENT_CORE_PROC, efficientThreads, procTypes);
+#else
+    // only the TBB arenas may be constrained by the core type, the nodes are executed on the calling thread
+    (void)performanceProcType;
+#endif
+}
+
+HybridNodePlacement::NodeCost HybridNodePlacement::estimateCost(const NodePtr& node) {
+    auto elements = [](const EdgePtr& edge) -> uint64_t {
+        auto mem = edge ? edge->getMemoryPtr() : nullptr;
+        if (!mem || !mem->getDesc().isDefined())
+            return 0;
+        return mem->getShape().getElementsCount();
+    };
+    auto bytes = [](const EdgePtr& edge) -> uint64_t {
+        auto mem = edge ? edge->getMemoryPtr() : nullptr;
+        if (!mem || !mem->getDesc().isDefined())
+            return 0;
+        return mem->getShape().getElementsCount() * mem->getDesc().getPrecision().size();
+    };
+
+    NodeCost cost{0, 0};
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        cost.bytes += bytes(node->getParentEdgeAt(i));
+    uint64_t outElements = 0;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        cost.bytes += bytes(node->getChildEdgeAt(i));
+        outElements += elements(node->getChildEdgeAt(i));
+    }
+
+    // a multiply-add per output element and reduction step for the compute bound nodes, an operation per output
+    // element for the rest of them
+    cost.ops = outElements;
+    switch (node->getType()) {
+    case Type::FullyConnected:
+    case Type::MatMul: {
+        if (node->getParentEdges().size() < 2 || node->getChildEdges().empty())
+            break;
+        const auto& weightsDims = node->getInputShapeAtPort(1).getStaticDims();
+        const auto& outDims = node->getOutputShapeAtPort(0).getStaticDims();
+        cost.ops = 2 * outElements * std::max<uint64_t>(1, matMulReduction(weightsDims, outDims));
+        break;
+    }
+    case Type::Convolution:
+    case Type::Deconvolution:
+    case Type::RNNCell:
+    case Type::RNNSeq:
+    case Type::MHA: {
+        if (node->getParentEdges().size() < 2 || node->getChildEdges().empty())
+            break;
+        const auto weights = elements(node->getParentEdgeAt(1));
+        const auto& outDims = node->getOutputShapeAtPort(0).getStaticDims();
+        const auto channels = outDims.size() > 1 ? outDims[1] : outDims.back();
+        cost.ops = 2 * outElements * std::max<uint64_t>(1, weights / std::max<size_t>(1, channels));
+        break;
+    }
+    default:
+        break;
+    }
+    return cost;
+}
+
+// the weights of FullyConnected are [N, K], the second input of MatMul is [..., K, N] or [..., N, K] if it's transposed,
+// while the output is [..., N] in all the cases, so the other one of the last two dims is the reduction one
+uint64_t HybridNodePlacement::matMulReduction(const VectorDims& weightsDims, const VectorDims& outDims) {
+    if (weightsDims.empty() || outDims.empty())
+        return 0;
+    if (weightsDims.size() == 1)
+        return weightsDims[0];
+    const auto N = outDims.back();
+    const auto last = weightsDims.back();
+    const auto prev = weightsDims[weightsDims.size() - 2];
+    return last == N ? prev : last;
+}
+
+HybridNodePlacement::CoreType HybridNodePlacement::classify(const NodeCost& cost) {
+    return cost.ops >= computeBoundIntensity * std::max<uint64_t>(1, cost.bytes) ? CoreType::Performance
+                                                                                 : CoreType::Efficient;
+}
+
+std::vector<HybridNodePlacement::Segment> HybridNodePlacement::makeSegments(const std::vector<CoreType>& coreTypes) {
+    std::vector<Segment> result;
+    for (size_t i = 0; i < coreTypes.size(); i++) {
+        if (!result.empty() && result.back().coreType == coreTypes[i]) {
+            result.back().end = i + 1;
+        } else {
+            result.push_back({coreTypes[i], i, i + 1});
+        }
+    }
+    return result;
+}
+
+void HybridNodePlacement::place(const std::vector<NodePtr>& nodes) {
+    std::vector<CoreType> coreTypes;
+    coreTypes.reserve(nodes.size());
+    for (const auto& node : nodes) {
+        coreTypes.push_back(classify(estimateCost(node)));
+        DEBUG_LOG("Hybrid placement of ", node->getName(), ": ",
+                  coreTypes.back() == CoreType::Performance ? "Performance-cores" : "Efficient-cores");
+    }
+    segments = makeSegments(coreTypes);
+}
+
+void HybridNodePlacement::run(CoreType coreType, const std::function<void()>& body) {
+    if (subArenas.empty()) {
+        body();
+        return;
+    }
+    subArenas[static_cast<size_t>(coreType)]->run_and_wait({body});
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
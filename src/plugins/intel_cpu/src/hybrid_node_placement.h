@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Placement of the nodes of a static graph on the core types of a hybrid CPU.
+ *
+ * The nodes are classified by their arithmetic intensity (operations per byte of the touched tensors): the compute
+ * bound nodes (convolutions, matrix multiplications, ...) are placed on the Performance-cores, the memory bound ones
+ * (reorders, eltwise, gathers, ...) on the Efficient-cores. The consecutive nodes of the same class form a segment,
+ * each segment is executed as a whole on the sub-arena of its core type, so the dispatch cost is paid per segment.
+ */
+class HybridNodePlacement {
+public:
+    using Ptr = std::shared_ptr<HybridNodePlacement>;
+
+    enum class CoreType {
+        Performance,
+        Efficient,
+    };
+
+    struct NodeCost {
+        uint64_t ops;
+        uint64_t bytes;
+    };
+
+    struct Segment {
+        CoreType coreType;
+        size_t begin;  // index of the first node of the segment in the execution order
+        size_t end;    // index past the last node of the segment
+    };
+
+    // the nodes performing at least this number of operations per byte are compute bound
+    static constexpr uint64_t computeBoundIntensity = 4;
+
+    /**
+     * @brief Splits the processors of the first row of the processors type table into the sub-arenas
+     * @param procTypeTable processors type table, a simulated one may be passed to check the placement
+     * on a non hybrid CPU
+     * @param useHyperThreading whether the logical cores of the Performance-cores are used
+     */
+    HybridNodePlacement(const std::vector<std::vector<int>>& procTypeTable, bool useHyperThreading);
+
+    /**
+     * @brief Checks whether there are processors of both core types, otherwise the placement brings nothing
+     */
+    bool isHybrid() const {
+        return performanceThreads > 0 && efficientThreads > 0;
+    }
+
+    int getThreads(CoreType coreType) const {
+        return coreType == CoreType::Performance ? performanceThreads : efficientThreads;
+    }
+
+    /**
+     * @brief Classifies the executable nodes and groups them into segments
+     * @param nodes executable nodes in the execution order, all the edges must be allocated
+     */
+    void place(const std::vector<NodePtr>& nodes);
+
+    const std::vector<Segment>& getSegments() const {
+        return segments;
+    }
+
+    /**
+     * @brief Executes the body on the sub-arena of the core type and waits for its completion,
+     * the exceptions thrown by the body are rethrown
+     */
+    void run(CoreType coreType, const std::function<void()>& body);
+
+    static NodeCost estimateCost(const NodePtr& node);
+
+    /**
+     * @brief Returns the reduction dim (K) of FullyConnected or MatMul by the dims of the weights and the output
+     */
+    static uint64_t matMulReduction(const VectorDims& weightsDims, const VectorDims& outDims);
+
+    static CoreType classify(const NodeCost& cost);
+
+    static std::vector<Segment> makeSegments(const std::vector<CoreType>& coreTypes);
+
+private:
+    int performanceThreads = 0;
+    int efficientThreads = 0;
+    std::vector<Segment> segments;
+    // single stream executors pinned to the core types, indexed by CoreType, empty if the CPU is not hybrid
+    std::vector<std::shared_ptr<ov::threading::IStreamsExecutor>> subArenas;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,19 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "infer_checkpoint.h"
+
+#include <ie_common.h>
+
+using namespace ov::intel_cpu;
+
+void InferCheckpoint::check() const {
+    if (m_canceled && m_canceled->load(std::memory_order_relaxed)) {
+        IE_THROW(InferCancelled);
+    }
+    if (m_deadline != Clock::time_point::max() && Clock::now() >= m_deadline) {
+        // not INFER_CANCELLED, the request was not canceled by the user
+        IE_THROW() << "The inference exceeded its latency budget";
+    }
+}
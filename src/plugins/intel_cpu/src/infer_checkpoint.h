@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Cancellation and deadline checkpoint of the inference running on a graph.
+ *
+ * The request arms the checkpoint of the graph for the time of its inference. The graph checks it between the nodes,
+ * and the nodes running long loops check it inside them (the iterations of TensorIterator and Loop run the body graph,
+ * the parallel kernels poll it at their chunk boundaries), so a canceled request or a request out of its latency budget
+ * frees the stream without waiting for the node to complete. The canceled inference fails with the INFER_CANCELLED
+ * status, the inference out of its budget fails with the GENERAL_ERROR status and the "latency budget" message. The
+ * outputs of the interrupted inference are undefined.
+ * The checkpoint is shared by the graph of a stream and its subgraphs, it's armed by the thread running the graph.
+ */
+class InferCheckpoint {
+public:
+    using Ptr = std::shared_ptr<InferCheckpoint>;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Arms the checkpoint for the scope of an inference
+     * @param canceled flag of the request raised by the cancellation, must outlive the scope
+     * @param deadline time the inference must be completed by, Clock::time_point::max() if it has no deadline
+     */
+    class Scope {
+    public:
+        Scope(InferCheckpoint& checkpoint, const std::atomic<bool>* canceled, Clock::time_point deadline)
+            : m_checkpoint(checkpoint) {
+            m_checkpoint.m_canceled = canceled;
+            m_checkpoint.m_deadline = deadline;
+        }
+
+        ~Scope() {
+            m_checkpoint.m_canceled = nullptr;
+            m_checkpoint.m_deadline = Clock::time_point::max();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        InferCheckpoint& m_checkpoint;
+    };
+
+    /**
+     * @brief Returns true if the inference must stop.
+     * It doesn't throw, so the worker threads of a parallel kernel poll it to skip the rest of their work, then the
+     * thread running the node calls check().
+     */
+    bool isInterrupted() const noexcept {
+        return (m_canceled && m_canceled->load(std::memory_order_relaxed)) ||
+               (m_deadline != Clock::time_point::max() && Clock::now() >= m_deadline);
+    }
+
+    /**
+     * @brief Throws the INFER_CANCELLED status if the inference is canceled, and the GENERAL_ERROR status if it is out
+     * of its latency budget
+     */
+    void check() const;
+
+private:
+    // written by the thread running the graph before the nodes are executed, so the worker threads see them
+    const std::atomic<bool>* m_canceled = nullptr;
+    Clock::time_point m_deadline = Clock::time_point::max();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -16,6 +16,7 @@
 #include "itt.h"
 #include "nodes/common/cpu_convert.h"
 #include "memory_state.h"
+#include "internal_properties.hpp"
 #include "nodes/memory.hpp"
 #include "nodes/common/cpu_memcpy.h"
 #include "async_infer_request.h"
@@ -39,12 +40,12 @@ void InferRequestBase::CreateInferRequest() {
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    latencyBudget = std::chrono::microseconds(execNetwork->_cfg.latencyBudget);
 
     initBlobs();
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    // The variable states own the memory the MemoryInput and MemoryOutput nodes work with during the inference
+    // of this request, so the state is neither copied into the graph nor out of it.
     for (auto& node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
@@ -52,14 +53,17 @@ void InferRequestBase::CreateInferRequest() {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
             auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
+            auto state_id = memoryNode->getId();
+            auto state_name = state_id;
 
             // Remove suffix with pair ID. Internal information.
             auto suffix_idx = state_name.find("/id=");
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            auto state = std::make_shared<VariableState>(state_name, memoryNode->getEngine(), state_store->getDescPtr());
+            statesById[state_id] = state;
+            memoryStates.emplace_back(state);
         }
     }
 }
@@ -95,50 +99,71 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
-void InferRequestBase::PushStates() {
+const std::vector<InferRequestBase::StateBinding>& InferRequestBase::getStateBindings() {
+    // the request may be executed by the graphs of different streams, the states are bound to each graph once
+    auto itr = stateBindings.find(graph);
+    if (itr != stateBindings.end())
+        return itr->second;
+
+    std::vector<StateBinding> bindings;
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
+            auto state = statesById.find(cur_node->getId());
+            if (state == statesById.end()) {
+                IE_THROW() << "Variable state for " << node->getName() << " was not found";
             }
+            bindings.push_back({cur_node, state->second});
         }
     }
+    return stateBindings.emplace(graph, std::move(bindings)).first->second;
 }
 
-void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+void InferRequestBase::SetStateSlots(std::vector<int> rowSlots) {
+    const auto& slots = execNetwork->_stateSlots;
+    if (!slots && !rowSlots.empty())
+        IE_THROW() << "The state slots are disabled, set the " << ov::intel_cpu::state_slots.name() << " property";
+    std::vector<bool> bound(slots ? slots->getCapacity() : 0, false);
+    for (auto slot : rowSlots) {
+        if (slot < 0)
+            continue;
+        if (static_cast<size_t>(slot) >= bound.size())
+            IE_THROW() << "State slot " << slot << " is out of range [0, " << bound.size() << ")";
+        // the new states of the rows bound to the same slot would overwrite each other
+        if (bound[slot])
+            IE_THROW() << "State slot " << slot << " is bound to several rows";
+        bound[slot] = true;
+    }
+    stateRowSlots = std::move(rowSlots);
+}
+
+void InferRequestBase::PushStates() {
+    for (const auto& binding : getStateBindings()) {
+        if (stateRowSlots.empty()) {
+            binding.node->assignState(binding.state->getStorage(),
+                                      binding.state->getNextStorage(),
+                                      binding.state->isResetPending());
+        } else {
+            binding.node->assignSlots(execNetwork->_stateSlots, stateRowSlots);
         }
     }
 }
 
+void InferRequestBase::PullStates() {
+    if (!stateRowSlots.empty())
+        return;
+    // the new state has been already written into the next state memory, so it only becomes current,
+    // the reset is still pending if the variable was not assigned during the inference
+    for (const auto& binding : getStateBindings()) {
+        if (binding.node->isStateStored())
+            binding.state->swapStorages();
+        binding.state->setResetPending(binding.node->isResetPending());
+    }
+}
+
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -158,7 +183,13 @@ void InferRequestBase::InferImpl() {
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
+    // the cancellation of the previous inference or of the idle request doesn't affect this one,
+    // the cancellation of this request before it started is reported by ThrowIfCanceled()
+    cancelRequested = false;
     ThrowIfCanceled();
+    const auto deadline = latencyBudget.count() > 0 ? InferCheckpoint::Clock::now() + latencyBudget
+                                                    : InferCheckpoint::Clock::time_point::max();
+    InferCheckpoint::Scope checkpointScope(*graph->getGraphContext()->getInferCheckpoint(), &cancelRequested, deadline);
     convertBatchedInputBlobs();
 
     if (graph->hasDynamicInput()) {
@@ -177,7 +208,7 @@ void InferRequestBase::InferImpl() {
         PushStates();
     }
 
-    graph->Infer(this);
+    graph->Infer();
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -364,6 +395,16 @@ void InferRequestBase::ThrowIfCanceled() const {
     }
 }
 
+void InferRequestBase::Cancel() {
+    cancelRequested = true;
+}
+
+void InferRequestBase::SetLatencyBudget(std::chrono::microseconds budget) {
+    if (budget.count() < 0)
+        IE_THROW() << "Latency budget must not be negative, got " << budget.count() << " us";
+    latencyBudget = budget;
+}
+
 InferenceEngine::Precision
 InferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const {
     const auto& inputTensorDesc = input.second->getTensorDesc();
@@ -937,7 +978,7 @@ void InferRequest::PushInputData() {
 
 InferRequestBase::OutputControlBlock::OutputControlBlock(const InferenceEngine::Precision& precision, const Shape& shape) {
     dnnl::engine eng(dnnl::engine::kind::cpu, 0);
-    m_buffers[m_buffIndx] = std::make_shared<MemoryMngrWithReuse>();
+    m_buffers[m_buffIndx] = std::make_shared<MemoryMngrWithReuse>(MemoryMngrWithReuse::dynamicGrowthFactor);
     m_proxyMemMngr = std::make_shared<ProxyMemoryMngr>(m_buffers[m_buffIndx]);
 
     Shape memShape = shape.isDynamic() ?
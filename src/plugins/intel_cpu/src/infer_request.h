@@ -5,9 +5,13 @@
 #pragma once
 
 #include "graph.h"
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include "cpu_tensor.h"
 
@@ -16,6 +20,11 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+class VariableState;
+
+namespace node {
+class MemoryInput;
+}   // namespace node
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -38,6 +47,25 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Interrupts the running inference at its next checkpoint, see InferCheckpoint
+     */
+    void Cancel() override;
+
+    /**
+     * @brief Sets the latency budget of the inferences of the request, overriding the CPU_LATENCY_BUDGET property.
+     * The inference out of the budget fails with the GENERAL_ERROR status, see InferCheckpoint.
+     * @param budget budget counted from the start of the inference on the stream, zero for no budget
+     */
+    void SetLatencyBudget(std::chrono::microseconds budget);
+
+    /**
+     * @brief Binds the rows of the batched states to the state slots of the compiled model, see StateSlots.
+     * The variable states of the request are neither read nor written while the rows are bound.
+     * @param rowSlots slot of each row of the batch, -1 for the rows bound to no slot, empty to unbind the rows
+     */
+    void SetStateSlots(std::vector<int> rowSlots);
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -86,7 +114,7 @@ protected:
         MemMngrPtr nextMemMngr() {
             m_buffIndx ^= 0x1;
             if (!m_buffers[m_buffIndx]) {
-                m_buffers[m_buffIndx] = std::make_shared<MemoryMngrWithReuse>();
+                m_buffers[m_buffIndx] = std::make_shared<MemoryMngrWithReuse>(MemoryMngrWithReuse::dynamicGrowthFactor);
             }
             return m_buffers[m_buffIndx];
         }
@@ -114,6 +142,12 @@ protected:
     std::unordered_map<std::string, OutputControlBlock> outputControlBlocks;
 
 private:
+    struct StateBinding {
+        node::MemoryInput* node;
+        std::shared_ptr<VariableState> state;
+    };
+
+    const std::vector<StateBinding>& getStateBindings();
     void PushStates();
     void PullStates();
     void redefineMemoryForInputNodes();
@@ -121,6 +155,11 @@ private:
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::unordered_map<std::string, std::shared_ptr<VariableState>> statesById;
+    std::unordered_map<const Graph*, std::vector<StateBinding>> stateBindings;
+    std::vector<int> stateRowSlots;
+    std::chrono::microseconds latencyBudget{0};
+    std::atomic<bool> cancelRequested{false};
     AsyncInferRequest*                  _asyncRequest = nullptr;
 
 protected:
@@ -0,0 +1,272 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "inter_op_scheduler.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "edge.h"
+#include "hybrid_node_placement.h"
+#include "utils/debug_capabilities.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+struct MemRange {
+    uintptr_t begin;
+    uintptr_t end;
+};
+
+inline bool intersects(const std::vector<MemRange>& lhs, const std::vector<MemRange>& rhs) {
+    for (const auto& l : lhs) {
+        for (const auto& r : rhs) {
+            if (l.begin < r.end && r.begin < l.end)
+                return true;
+        }
+    }
+    return false;
+}
+
+inline void collectRanges(const std::vector<EdgeWeakPtr>& edges, std::vector<MemRange>& ranges) {
+    for (const auto& weakEdge : edges) {
+        auto edge = weakEdge.lock();
+        if (!edge)
+            continue;
+        auto mem = edge->getMemoryPtr();
+        if (!mem || !mem->getDesc().isDefined())
+            continue;
+        const auto size = mem->getSize();
+        const auto data = reinterpret_cast<uintptr_t>(mem->getData());
+        if (size == 0 || data == 0)
+            continue;
+        ranges.push_back({data, data + size});
+    }
+}
+
+// Nodes which have side effects beyond their output tensors or execute nested graphs sharing the scratch pads.
+// Such nodes are always executed alone.
+inline bool isSerializationPoint(const NodePtr& node) {
+    switch (node->getType()) {
+    case Type::MemoryInput:
+    case Type::MemoryOutput:
+    case Type::TensorIterator:
+    case Type::If:
+        return true;
+    default:
+        return false;
+    }
+}
+
+}   // namespace
+
+uint64_t InterOpScheduler::estimateCost(const NodePtr& node) {
+    // The cost is the number of elements touched by the node, for the compute bound nodes it is scaled
+    // by the reduction length (the weights elements per one output channel, the K dim of FullyConnected and MatMul).
+    auto elements = [](const EdgePtr& edge) -> uint64_t {
+        auto mem = edge ? edge->getMemoryPtr() : nullptr;
+        if (!mem || !mem->getDesc().isDefined())
+            return 0;
+        return mem->getShape().getElementsCount();
+    };
+
+    uint64_t inElements = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        inElements += elements(node->getParentEdgeAt(i));
+    uint64_t outElements = 0;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        outElements += elements(node->getChildEdgeAt(i));
+
+    uint64_t cost = inElements + outElements;
+    switch (node->getType()) {
+    case Type::FullyConnected:
+    case Type::MatMul: {
+        if (node->getParentEdges().size() < 2 || node->getChildEdges().empty())
+            break;
+        const auto& weightsDims = node->getInputShapeAtPort(1).getStaticDims();
+        const auto& outDims = node->getOutputShapeAtPort(0).getStaticDims();
+        cost += outElements * std::max<uint64_t>(1, HybridNodePlacement::matMulReduction(weightsDims, outDims));
+        break;
+    }
+    case Type::Convolution:
+    case Type::Deconvolution:
+    case Type::RNNCell:
+    case Type::RNNSeq:
+    case Type::MHA: {
+        if (node->getParentEdges().size() < 2 || node->getChildEdges().empty())
+            break;
+        const auto weights = elements(node->getParentEdgeAt(1));
+        const auto& outDims = node->getOutputShapeAtPort(0).getStaticDims();
+        const auto channels = outDims.size() > 1 ? outDims[1] : outDims.back();
+        cost += outElements * std::max<uint64_t>(1, weights / std::max<size_t>(1, channels));
+        break;
+    }
+    default:
+        break;
+    }
+    return std::max<uint64_t>(1, cost);
+}
+
+InterOpScheduler::InterOpScheduler(const std::vector<NodePtr>& nodes, int maxLanes, int numThreads)
+    : numThreads(std::max(1, numThreads)) {
+    const size_t lanes = static_cast<size_t>(std::max(1, std::min(maxLanes, this->numThreads)));
+
+    const size_t numNodes = nodes.size();
+    std::unordered_map<const Node*, size_t> execIndex;
+    for (size_t i = 0; i < numNodes; i++)
+        execIndex[nodes[i].get()] = i;
+
+    std::vector<std::vector<MemRange>> reads(numNodes), writes(numNodes);
+    for (size_t i = 0; i < numNodes; i++) {
+        collectRanges(nodes[i]->getParentEdges(), reads[i]);
+        collectRanges(nodes[i]->getChildEdges(), writes[i]);
+    }
+
+    // executable predecessors of the node, the non executable (optimized out) nodes are looked through
+    auto dataPredecessors = [&](const NodePtr& node) {
+        std::vector<size_t> result;
+        std::unordered_set<const Node*> visited;
+        std::vector<NodePtr> stack{node};
+        while (!stack.empty()) {
+            auto current = stack.back();
+            stack.pop_back();
+            for (size_t i = 0; i < current->getParentEdges().size(); i++) {
+                auto parent = current->getParentEdgeAt(i)->getParent();
+                if (!visited.insert(parent.get()).second)
+                    continue;
+                auto itr = execIndex.find(parent.get());
+                if (itr != execIndex.end()) {
+                    result.push_back(itr->second);
+                } else {
+                    stack.push_back(parent);
+                }
+            }
+        }
+        return result;
+    };
+
+    std::vector<size_t> level(numNodes, 0);
+    size_t barrier = 0;  // the level all the nodes must follow, set by the serialization points
+    size_t maxLevel = 0;
+    for (size_t i = 0; i < numNodes; i++) {
+        const auto& node = nodes[i];
+        size_t nodeLevel = barrier;
+        if (isSerializationPoint(node)) {
+            nodeLevel = maxLevel + 1;
+            barrier = nodeLevel + 1;
+        } else {
+            for (auto pred : dataPredecessors(node)) {
+                if (pred < i)
+                    nodeLevel = std::max(nodeLevel, level[pred] + 1);
+            }
+            // respect the memory reuse: write after read, read after write and write after write hazards
+            for (size_t j = 0; j < i; j++) {
+                if (level[j] + 1 <= nodeLevel)
+                    continue;
+                if (intersects(writes[j], reads[i]) || intersects(writes[j], writes[i]) || intersects(reads[j], writes[i]))
+                    nodeLevel = level[j] + 1;
+            }
+        }
+        level[i] = nodeLevel;
+        maxLevel = std::max(maxLevel, nodeLevel);
+    }
+
+    std::vector<std::vector<size_t>> levels(numNodes ? maxLevel + 1 : 0);
+    for (size_t i = 0; i < numNodes; i++)
+        levels[level[i]].push_back(i);
+
+    for (const auto& nodesOfLevel : levels) {
+        // the nodes of the same level are independent, so the level may be split into several waves
+        for (size_t start = 0; start < nodesOfLevel.size(); start += lanes) {
+            const size_t end = std::min(nodesOfLevel.size(), start + lanes);
+            Wave wave;
+            uint64_t totalCost = 0;
+            std::vector<uint64_t> costs;
+            for (size_t k = start; k < end; k++) {
+                costs.push_back(estimateCost(nodes[nodesOfLevel[k]]));
+                totalCost += costs.back();
+            }
+
+            int assigned = 0;
+            for (size_t k = start; k < end; k++) {
+                const auto lane = static_cast<int>(k - start);
+                const auto share = static_cast<int>(this->numThreads * costs[lane] / totalCost);
+                wave.push_back({nodes[nodesOfLevel[k]], lane, std::max(1, share)});
+                assigned += wave.back().threads;
+            }
+
+            // hand the threads left after rounding to the most expensive tasks
+            if (wave.size() > 1) {
+                std::vector<size_t> order(wave.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                    return costs[a] > costs[b];
+                });
+                for (size_t k = 0; assigned < this->numThreads; k = (k + 1) % order.size(), assigned++)
+                    wave[order[k]].threads++;
+            }
+
+            DEBUG_LOG("Inter-op wave #", waves.size(), " with ", wave.size(), " nodes");
+            waves.push_back(std::move(wave));
+        }
+    }
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    arenas.resize(waves.size());
+    for (size_t i = 0; i < waves.size(); i++) {
+        if (waves[i].size() == 1)
+            continue;
+        for (const auto& task : waves[i]) {
+            // one slot is reserved for the thread entering the arena from the stream arena
+            arenas[i].emplace_back(new tbb::task_arena(task.threads, 1));
+        }
+    }
+#endif
+}
+
+bool InterOpScheduler::hasParallelWaves() const {
+    return std::any_of(waves.begin(), waves.end(), [](const Wave& wave) {
+        return wave.size() > 1;
+    });
+}
+
+bool InterOpScheduler::covers(const std::vector<NodePtr>& nodes) const {
+    std::unordered_set<const Node*> scheduled;
+    for (const auto& wave : waves) {
+        for (const auto& task : wave)
+            scheduled.insert(task.node.get());
+    }
+    if (scheduled.size() != nodes.size())
+        return false;
+    return std::all_of(nodes.begin(), nodes.end(), [&](const NodePtr& node) {
+        return scheduled.count(node.get());
+    });
+}
+
+void InterOpScheduler::run(size_t waveIdx, const std::function<void(const Task&)>& body) {
+    const auto& wave = waves[waveIdx];
+    if (wave.size() == 1) {
+        body(wave.front());
+        return;
+    }
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    auto& waveArenas = arenas[waveIdx];
+    tbb::parallel_for(size_t(0), wave.size(), size_t(1), [&](size_t i) {
+        waveArenas[i]->execute([&] {
+            body(wave[i]);
+        });
+    }, tbb::simple_partitioner());
+#else
+    for (const auto& task : wave)
+        body(task);
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_parallel.hpp"
+#include "node.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Inter-op execution plan of a static graph.
+ *
+ * The executable nodes are grouped into waves. The nodes of a wave depend neither on each other's data nor on each other's
+ * memory (the memory reuse plan made by the memory solver places tensors with non-overlapping lifetimes into the same memory,
+ * so such nodes must keep their relative order), so they may be executed simultaneously. The waves are executed one after another.
+ * Each node of a wave gets an inter-op lane (which selects the scratch pad used by the node) and a thread budget proportional to the
+ * estimated cost of the node.
+ */
+class InterOpScheduler {
+public:
+    using Ptr = std::shared_ptr<InterOpScheduler>;
+
+    struct Task {
+        NodePtr node;
+        int lane;
+        int threads;
+    };
+
+    using Wave = std::vector<Task>;
+
+    /**
+     * @brief Builds the execution plan
+     * @param nodes executable nodes in the execution order, all the edges must be allocated
+     * @param maxLanes maximum number of nodes executed simultaneously
+     * @param numThreads number of threads available to the graph
+     */
+    InterOpScheduler(const std::vector<NodePtr>& nodes, int maxLanes, int numThreads);
+
+    const std::vector<Wave>& getWaves() const {
+        return waves;
+    }
+
+    /**
+     * @brief Checks whether at least one wave contains independent nodes, otherwise the plan brings nothing but overhead
+     */
+    bool hasParallelWaves() const;
+
+    /**
+     * @brief Checks that the plan executes exactly the given nodes
+     */
+    bool covers(const std::vector<NodePtr>& nodes) const;
+
+    /**
+     * @brief Executes the body for each task of the wave, tasks are executed simultaneously within their thread budgets
+     */
+    void run(size_t waveIdx, const std::function<void(const Task&)>& body);
+
+    static uint64_t estimateCost(const NodePtr& node);
+
+private:
+    std::vector<Wave> waves;
+    int numThreads;
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    // nested arenas limiting the concurrency of each task
+    std::vector<std::vector<std::unique_ptr<tbb::task_arena>>> arenas;
+#endif
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for experimental properties which are handled by the CPU plugin only
+ * @file internal_properties.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Enables inter-op parallel execution of independent branches of a static CPU graph
+ *
+ * Executable nodes of the graph are grouped into waves of mutually independent nodes (neither data nor
+ * memory reuse dependencies between them). The nodes of one wave are executed simultaneously on nested
+ * task arenas, each of them gets a share of the stream threads proportional to its estimated cost.
+ * Dynamic graphs are always executed sequentially.
+ */
+static constexpr Property<bool> inter_op_parallelism{"CPU_INTER_OP_PARALLELISM"};
+
+/**
+ * @brief Enables experimental placement of the nodes of a static CPU graph on the core types of a hybrid CPU
+ *
+ * The nodes are classified by their arithmetic intensity: the compute bound ones are executed on a sub-arena of
+ * the Performance-cores, the memory bound ones on a sub-arena of the Efficient-cores. It's applied to the graphs
+ * of a single stream only, which spans both core types, and is ignored if the CPU isn't hybrid or the scheduling
+ * core type is restricted.
+ */
+static constexpr Property<bool> hybrid_node_placement{"CPU_HYBRID_NODE_PLACEMENT"};
+
+/**
+ * @brief Places the activations and the scratch pads of each stream graph on the NUMA node of the stream
+ *
+ * The weights repacked by the graph are placed the same way, since they are shared by the streams of one socket only.
+ * The pages of the buffers are bound to the node and faulted in when the buffers are allocated, instead of relying
+ * on the first touch, which may happen on another node. It's meant for the throughput mode on multi-socket machines,
+ * where each stream runs within one NUMA node.
+ */
+static constexpr Property<bool> numa_local_activations{"CPU_NUMA_LOCAL_ACTIVATIONS"};
+
+/**
+ * @brief Sub-allocates the intermediate dynamic tensors of each graph from an arena of the stream
+ *
+ * The arena is a block the buffers are bumped from, so the inferences with the shapes seen before don't allocate any
+ * memory. The buffers which don't fit into the block are allocated aside and the block is grown to fit all of them
+ * after the inference. The inputs and the outputs of the graph keep their own buffers.
+ */
+static constexpr Property<bool> dynamic_memory_arena{"CPU_DYNAMIC_MEMORY_ARENA"};
+
+/**
+ * @brief Number of the state slots of a stateful model, 0 (default) disables them
+ *
+ * Each slot holds the states of one sequence (one row of the batched states). The infer requests bind the rows of their
+ * batch to the slots, so the independent sequences served by one batched request may join and leave the batch between
+ * the inferences. The MemoryInput and MemoryOutput nodes gather and scatter the rows of the states.
+ */
+static constexpr Property<uint32_t> state_slots{"CPU_STATE_SLOTS"};
+
+/**
+ * @brief Latency budget of the inferences in microseconds, 0 (default) means no budget
+ *
+ * The budget is counted from the start of the inference on the stream. An inference out of its budget is interrupted
+ * at the next checkpoint (between the nodes, between the iterations of TensorIterator and Loop, at the chunk boundaries
+ * of the parallel kernels) and fails with the GENERAL_ERROR status and the "The inference exceeded its latency budget"
+ * message (ov::Exception, not ov::Cancelled reported for the canceled inference), which frees the stream for the next
+ * request. The property of an infer request overrides the property of the compiled model for the request.
+ */
+static constexpr Property<uint32_t> latency_budget{"CPU_LATENCY_BUDGET"};
+
+/**
+ * @brief Huge pages used for the buffers of the compiled model: "NO", "TRANSPARENT" or "EXPLICIT"
+ *
+ * The activations of each graph are packed by the memory solver into one workspace, which is allocated as a whole
+ * together with the dynamic tensors and the scratch pads. In the "TRANSPARENT" mode the buffers of at least 2 MB are
+ * aligned to 2 MB and advised to be backed by the transparent huge pages. In the "EXPLICIT" mode they are mapped
+ * from the pool of the explicit huge pages (hugetlbfs), falling back to the transparent ones if the pool is not
+ * configured or exhausted. The repacked weights use the transparent huge pages in the "NO" mode as well.
+ */
+static constexpr Property<std::string> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief Read-only statistics of the memory held by the buffers of the compiled model
+ *
+ * The map contains the following items (in bytes): "allocated", "explicit_huge_pages" and "transparent_huge_pages"
+ * (the parts of the allocated memory mapped from the explicit huge pages and advised to use the transparent ones).
+ * The "dynamic_arena_peak_usage" (in bytes, the largest usage of the arena of a stream within one inference) and
+ * "dynamic_arena_fallback_allocations" (the number of the dynamic tensors allocated aside the arenas) items are
+ * non-zero with the dynamic memory arena only.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_statistics{
+    "CPU_MEMORY_STATISTICS"};
+
+/**
+ * @brief Read-only statistics of the runtime primitive cache used by the compiled model
+ *
+ * The cache is shared by all the streams of the compiled model and is never shared with the other compiled models,
+ * so a primitive created for one model configuration is never reused by another one. The map contains the following items: "hits", "misses", "evictions", "size"
+ * and "capacity" (the last two are the numbers of records).
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only statistics of the task queues of the streams executor per priority of the infer requests
+ *
+ * The priority and the deadline of a request are set by the ov::hint::priority and ov::intel_cpu::latency_budget
+ * properties of the request. For each priority ("high", "medium" and "low") the map contains the "<priority>_depth"
+ * (the number of the queued runs), "<priority>_dispatched" (the number of the runs taken by the streams),
+ * "<priority>_total_delay_us" and "<priority>_max_delay_us" (the queuing delays of the dispatched runs) items. The runs
+ * of the requests without the priority and the deadline are not counted. The items are zero with the shared streams
+ * pool and with exclusive_async_requests, their queues are not tracked.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> queue_statistics{
+    "CPU_QUEUE_STATISTICS"};
+
+}  // namespace intel_cpu
+}  // namespace ov
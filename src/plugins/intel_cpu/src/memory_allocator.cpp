@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_allocator.h"
+
+#include <common/utils.hpp>
+#include <vector>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+#if defined(__linux__)
+// The binding is best effort, the buffer keeps the default policy (first touch) if it fails.
+// The syscall is used directly, since numaif.h is a part of libnuma the plugin doesn't depend on.
+void bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    constexpr int mpolPreferred = 1;  // MPOL_PREFERRED, the pages fall back to the other nodes if the node is full
+    constexpr size_t maxNodes = 1024;
+    constexpr size_t bitsPerMask = 8 * sizeof(unsigned long);
+    if (static_cast<size_t>(numaNodeId) >= maxNodes)
+        return;
+    std::vector<unsigned long> nodeMask(maxNodes / bitsPerMask, 0ul);
+    nodeMask[numaNodeId / bitsPerMask] |= 1ul << (numaNodeId % bitsPerMask);
+    // the kernel takes the number of the mask bits plus one
+    if (syscall(SYS_mbind, ptr, size, mpolPreferred, nodeMask.data(), maxNodes + 1, 0) != 0)
+        return;
+    // fault the pages in now, so the first inference doesn't pay for them
+    auto* bytes = static_cast<volatile char*>(ptr);
+    for (size_t offset = 0; offset < size; offset += MemoryAllocator::pageSize)
+        bytes[offset] = 0;
+}
+#endif
+
+inline size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+// accounts the buffer in the statistics, returns the deleter which takes it out of them
+std::function<void(void*)> track(const MemoryStatistics::Ptr& statistics,
+                                 size_t size,
+                                 std::atomic<uint64_t> MemoryStatistics::*hugePages,
+                                 std::function<void(void*)> release) {
+    if (!statistics)
+        return release;
+    statistics->allocated += size;
+    if (hugePages)
+        ((*statistics).*hugePages) += size;
+    return [statistics, size, hugePages, release](void* ptr) {
+        release(ptr);
+        statistics->allocated -= size;
+        if (hugePages)
+            ((*statistics).*hugePages) -= size;
+    };
+}
+
+}   // namespace
+
+MemoryAllocator::MemoryAllocator(HugePagesMode mode, int numaNodeId, MemoryStatistics::Ptr statistics)
+    : mode(mode), numaNodeId(numaNodeId), statistics(std::move(statistics)) {}
+
+MemoryAllocator::Buffer MemoryAllocator::allocate(size_t& size) const {
+    const bool useHugePages = mode != HugePagesMode::Disabled && size >= hugePageSize;
+    const bool numaLocal = numaNodeId >= 0;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    if (useHugePages && mode == HugePagesMode::Explicit) {
+        const size_t mappedSize = roundUp(size, hugePageSize);
+        void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        // the pool of the explicit huge pages is not configured or exhausted, fall back to the transparent ones
+        if (ptr != MAP_FAILED) {
+            if (numaLocal)
+                bindToNumaNode(ptr, mappedSize, numaNodeId);
+            size = mappedSize;
+            return Buffer(ptr, track(statistics, mappedSize, &MemoryStatistics::explicitHugePages, [mappedSize](void* p) {
+                munmap(p, mappedSize);
+            }));
+        }
+    }
+#endif
+
+    // the memory policy and the huge pages are applied to whole pages,
+    // so the buffer must not share them with the other allocations
+    const size_t alignment = useHugePages ? hugePageSize : (numaLocal ? pageSize : cacheLineSize);
+    if (useHugePages || numaLocal)
+        size = roundUp(size, alignment);
+    void* ptr = dnnl::impl::malloc(size, static_cast<int>(alignment));
+    if (!ptr)
+        return nullptr;
+#if defined(__linux__)
+    // the hint is best effort, the memory is backed by the regular pages if THP is disabled
+    if (useHugePages)
+        madvise(ptr, size, MADV_HUGEPAGE);
+    if (numaLocal)
+        bindToNumaNode(ptr, size, numaNodeId);
+#endif
+    return Buffer(ptr, track(statistics, size, useHugePages ? &MemoryStatistics::transparentHugePages : nullptr, [](void* p) {
+        dnnl::impl::free(p);
+    }));
+}
+
+const MemoryAllocator::Ptr& MemoryAllocator::getDefault(HugePagesMode mode) {
+    static const Ptr allocators[] = {std::make_shared<MemoryAllocator>(HugePagesMode::Disabled),
+                                     std::make_shared<MemoryAllocator>(HugePagesMode::Transparent),
+                                     std::make_shared<MemoryAllocator>(HugePagesMode::Explicit)};
+    return allocators[static_cast<size_t>(mode)];
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace ov {
+namespace intel_cpu {
+
+enum class HugePagesMode {
+    Disabled,     // the regular pages
+    Transparent,  // the large buffers are advised to be backed by the transparent huge pages
+    Explicit,     // the large buffers are mapped from the pool of the explicit huge pages (hugetlbfs)
+};
+
+/**
+ * @brief Counters of the memory held by the allocators of a compiled model
+ */
+struct MemoryStatistics {
+    using Ptr = std::shared_ptr<MemoryStatistics>;
+
+    std::atomic<uint64_t> allocated{0};             // bytes currently allocated
+    std::atomic<uint64_t> explicitHugePages{0};     // the part of them mapped from the explicit huge pages
+    std::atomic<uint64_t> transparentHugePages{0};  // the part of them advised to use the transparent huge pages
+    std::atomic<uint64_t> arenaPeakUsage{0};            // the largest usage of a dynamic memory arena within an inference
+    std::atomic<uint64_t> arenaFallbackAllocations{0};  // the buffers of the dynamic tensors allocated aside the arenas
+};
+
+/**
+ * @brief Allocator of the buffers of the memory managers.
+ *
+ * The buffers of at least the huge page size may be backed by the huge pages: in the explicit mode they are mapped
+ * from the hugetlbfs pool, and if the pool is not configured or exhausted, the allocator falls back to the transparent
+ * huge pages, which in turn are backed by the regular pages if THP is disabled in the system. With a NUMA node id given,
+ * the pages of the buffers are bound to the node and faulted in on allocation, so a buffer is local to the node
+ * regardless of the thread touching it first.
+ */
+class MemoryAllocator {
+public:
+    using Ptr = std::shared_ptr<MemoryAllocator>;
+    // the deleter returns the buffer to the system, so the buffer may outlive the allocator
+    using Buffer = std::unique_ptr<void, std::function<void(void*)>>;
+
+    static constexpr size_t cacheLineSize = 64;
+    static constexpr size_t pageSize = 4 * 1024;
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    explicit MemoryAllocator(HugePagesMode mode = HugePagesMode::Disabled,
+                             int numaNodeId = -1,
+                             MemoryStatistics::Ptr statistics = nullptr);
+
+    /**
+     * @brief Allocates a buffer of at least the given size
+     * @param size requested size in bytes, it's updated to the size of the allocated buffer
+     * @return the buffer, null if the memory is exhausted
+     */
+    Buffer allocate(size_t& size) const;
+
+    HugePagesMode getHugePagesMode() const {
+        return mode;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    const MemoryStatistics::Ptr& getStatistics() const {
+        return statistics;
+    }
+
+    /**
+     * @brief Returns the process-wide allocator with the given huge pages mode, not bound to any NUMA node
+     */
+    static const Ptr& getDefault(HugePagesMode mode = HugePagesMode::Disabled);
+
+private:
+    HugePagesMode mode;
+    int numaNodeId;
+    MemoryStatistics::Ptr statistics;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,6 +5,7 @@
 #include "cpu_blocked_memory_desc.h"
 #include <cpu_memory.h>
 #include "dnnl_blocked_memory_desc.h"
+#include "utils/general_utils.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -124,6 +125,10 @@ size_t CpuBlockedMemoryDesc::getCurrentMemSizeImp() const {
             e_size += (getBlockDims()[j] - 1) * getStrides()[j];
     }
 
+    // two 4-bit values are packed into a byte
+    if (one_of(getPrecision(), InferenceEngine::Precision::U4, InferenceEngine::Precision::I4))
+        return div_up(e_size, 2);
+
     e_size *= getPrecision() == InferenceEngine::Precision::BIN ? 1 : getPrecision().size();
 
     return e_size;
@@ -5,6 +5,11 @@
 #include "memory_state.h"
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+
+#include <algorithm>
+#include <iterator>
 
 using namespace InferenceEngine;
 
@@ -12,9 +17,144 @@ namespace ov {
 namespace intel_cpu {
 
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    resetPending = true;
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW() << "Variable state " << name << " cannot be set to an empty blob";
+    const auto storage = getStorage();
+    if (newState->byteSize() != storage->getSize())
+        IE_THROW() << "Variable state " << name << " has size " << storage->getSize()
+                   << " bytes, but the new state has size " << newState->byteSize() << " bytes";
+    if (newState->cbuffer().as<const void*>() != storage->getData())
+        cpu_memcpy(storage->getData(), newState->cbuffer().as<const void*>(), storage->getSize());
+    resetPending = false;
+}
+
+Blob::CPtr VariableState::GetState() const {
+    if (resetPending) {
+        getStorage()->nullify();
+        resetPending = false;
+    }
+    return state;
+}
+
+StateSlots::StateSlots(const dnnl::engine& eng,
+                       size_t capacity,
+                       const std::unordered_map<std::string, MemoryDescPtr>& variables)
+    : eng(eng), capacity(capacity), used(capacity, false) {
+    for (const auto& item : variables) {
+        const auto& desc = item.second;
+        if (!desc->isDefined() || desc->getShape().getRank() == 0 || !desc->hasLayoutType(LayoutType::ncsp))
+            IE_THROW() << "Variable " << item.first << " can't be stored in the state slots: the state must be planar "
+                       << "and have the batch dimension";
+        auto rowDims = desc->getShape().getStaticDims();
+        const auto rows = rowDims[0];
+        rowDims[0] = 1;
+        Variable variable;
+        variable.rowDesc = std::make_shared<CpuBlockedMemoryDesc>(desc->getPrecision(), Shape(rowDims));
+        variable.rows = rows;
+        variable.rowSize = variable.rowDesc->getCurrentMemSize();
+        variable.storage = std::make_shared<Memory>(
+            eng, CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{capacity * variable.rowSize})));
+        variable.resetPending.assign(capacity, 1);
+        this->variables.emplace(item.first, std::move(variable));
+    }
+}
+
+int StateSlots::acquire() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto freeSlot = std::find(used.begin(), used.end(), false);
+    if (freeSlot == used.end())
+        IE_THROW() << "All the " << capacity << " state slots are in use";
+    *freeSlot = true;
+    const auto slot = static_cast<int>(std::distance(used.begin(), freeSlot));
+    for (auto& variable : variables) {
+        variable.second.resetPending[slot] = 1;
+    }
+    return slot;
+}
+
+void StateSlots::release(int slot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    checkSlot(slot);
+    used[slot] = false;
+}
+
+void StateSlots::reset(int slot) {
+    checkSlot(slot);
+    for (auto& variable : variables) {
+        variable.second.resetPending[slot] = 1;
+    }
+}
+
+void StateSlots::checkSlot(int slot) const {
+    if (slot < 0 || static_cast<size_t>(slot) >= capacity)
+        IE_THROW() << "State slot " << slot << " is out of range [0, " << capacity << ")";
+}
+
+StateSlots::Variable& StateSlots::getVariable(const std::string& variableId) {
+    auto variable = variables.find(variableId);
+    if (variable == variables.end())
+        IE_THROW() << "Variable " << variableId << " is not stored in the state slots";
+    return variable->second;
+}
+
+MemoryPtr StateSlots::getState(const std::string& variableId, int slot) {
+    checkSlot(slot);
+    auto& variable = getVariable(variableId);
+    auto* data = static_cast<uint8_t*>(variable.storage->getData()) + slot * variable.rowSize;
+    if (variable.resetPending[slot]) {
+        std::fill_n(data, variable.rowSize, 0);
+        variable.resetPending[slot] = 0;
+    }
+    return std::make_shared<Memory>(eng, variable.rowDesc, data);
+}
+
+void StateSlots::gather(const std::string& variableId, const std::vector<int>& rowSlots, const IMemory& dst) {
+    auto& variable = getVariable(variableId);
+    if (rowSlots.size() != variable.rows)
+        IE_THROW() << "Variable " << variableId << " has " << variable.rows << " rows, but " << rowSlots.size()
+                   << " rows are bound to the state slots";
+    const auto* storage = static_cast<const uint8_t*>(variable.storage->getData());
+    auto* dstPtr = static_cast<uint8_t*>(dst.getData());
+    for (size_t row = 0; row < rowSlots.size(); row++) {
+        const auto slot = rowSlots[row];
+        auto* dstRow = dstPtr + row * variable.rowSize;
+        if (slot < 0 || variable.resetPending[slot]) {
+            std::fill_n(dstRow, variable.rowSize, 0);
+        } else {
+            cpu_memcpy(dstRow, storage + slot * variable.rowSize, variable.rowSize);
+        }
+    }
+}
+
+void StateSlots::scatter(const std::string& variableId, const std::vector<int>& rowSlots, const IMemory& src) {
+    auto& variable = getVariable(variableId);
+    if (rowSlots.size() != variable.rows)
+        IE_THROW() << "Variable " << variableId << " has " << variable.rows << " rows, but " << rowSlots.size()
+                   << " rows are bound to the state slots";
+    const auto srcPrecision = src.getDesc().getPrecision();
+    const auto dstPrecision = variable.rowDesc->getPrecision();
+    const auto rowElements = variable.rowDesc->getShape().getElementsCount();
+    const auto srcRowSize = rowElements * srcPrecision.size();
+    const auto* srcPtr = static_cast<const uint8_t*>(src.getData());
+    auto* storage = static_cast<uint8_t*>(variable.storage->getData());
+    for (size_t row = 0; row < rowSlots.size(); row++) {
+        const auto slot = rowSlots[row];
+        if (slot < 0)
+            continue;
+        const auto* srcRow = srcPtr + row * srcRowSize;
+        auto* dstRow = storage + slot * variable.rowSize;
+        if (srcPrecision == dstPrecision) {
+            cpu_memcpy(dstRow, srcRow, variable.rowSize);
+        } else {
+            cpu_convert(srcRow, dstRow, srcPrecision, dstPrecision, rowElements);
+        }
+        variable.resetPending[slot] = 0;
+    }
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
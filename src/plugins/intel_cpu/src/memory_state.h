@@ -10,21 +10,148 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The variable state owns the memory which is read by the MemoryInput node and written by the MemoryOutput node
+ * of the graph directly, so no copies are made before and after the inference.
+ * The memory is double buffered: the graph reads the current state from one buffer and writes the new one into
+ * the other, then the buffers are swapped. The state blob shares the memory of the current buffer.
+ * The reset is lazy: the memory is filled with zeros only if the state is read before the next inference,
+ * otherwise the MemoryInput node produces zeros on its own.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
+    VariableState(std::string name, const dnnl::engine& eng, MemoryDescPtr desc)
         : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
+        for (size_t i = 0; i < storages.size(); i++) {
+            storages[i] = std::make_shared<Memory>(eng, desc);
+            blobs[i] = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(*desc), storages[i]->getData());
+        }
+        state = blobs[current];
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * @brief Returns the buffer holding the current state
+     */
+    MemoryPtr getStorage() const {
+        return storages[current];
+    }
+
+    /**
+     * @brief Returns the buffer the new state is written into during the inference
+     */
+    MemoryPtr getNextStorage() const {
+        return storages[current ^ 1];
+    }
+
+    /**
+     * @brief Makes the new state written during the inference current
+     */
+    void swapStorages() {
+        current ^= 1;
+        state = blobs[current];
+    }
+
+    bool isResetPending() const {
+        return resetPending;
+    }
+
+    void setResetPending(bool pending) {
+        resetPending = pending;
+    }
+
+private:
+    std::array<MemoryPtr, 2> storages;
+    std::array<InferenceEngine::Blob::Ptr, 2> blobs;
+    size_t current = 0;
+    // the default state is zero filled
+    mutable bool resetPending = true;
+};
+
+/**
+ * @brief Pool of the states of the independent sequences served by the batched inferences of a stateful model.
+ *
+ * Each slot holds one row (the state of a batch of 1) of every variable of the model. An infer request binds the rows
+ * of its batch to the slots, then the MemoryInput node gathers the states of the bound slots into the rows of
+ * the batched state and the MemoryOutput node scatters the new rows back into the slots. So a sequence may join
+ * the batch (acquire a slot and bind it to a free row) or leave it (unbind the row and release the slot) between
+ * any two inferences, without copying the states of the other sequences. The rows bound to no slot read zeros and
+ * their new state is dropped.
+ * The states must be planar with the batch as the first dimension. The slots are acquired and released concurrently
+ * with the inferences, but a slot must not be released while a running inference is bound to it.
+ */
+class StateSlots {
+public:
+    using Ptr = std::shared_ptr<StateSlots>;
+
+    /**
+     * @param capacity number of the slots
+     * @param variables batched state descriptors of the variables, keyed by the variable ids
+     */
+    StateSlots(const dnnl::engine& eng, size_t capacity, const std::unordered_map<std::string, MemoryDescPtr>& variables);
+
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * @brief Takes a free slot, its state is zero filled
+     * @return the slot index
+     */
+    int acquire();
+
+    void release(int slot);
+
+    void reset(int slot);
+
+    /**
+     * @brief Returns the state of one sequence, i.e. the row of the variable stored in the slot
+     */
+    MemoryPtr getState(const std::string& variableId, int slot);
+
+    /**
+     * @brief Copies the rows of the variable stored in the slots into the batched state
+     * @param rowSlots slot of each row of the batch, -1 for the rows bound to no slot
+     */
+    void gather(const std::string& variableId, const std::vector<int>& rowSlots, const IMemory& dst);
+
+    /**
+     * @brief Copies the rows of the batched state into the slots, converting the precision if needed
+     * @param rowSlots slot of each row of the batch, -1 for the rows bound to no slot
+     */
+    void scatter(const std::string& variableId, const std::vector<int>& rowSlots, const IMemory& src);
+
+private:
+    struct Variable {
+        MemoryDescPtr rowDesc;
+        size_t rows;     // batch of the inference
+        size_t rowSize;  // in bytes
+        MemoryPtr storage;
+        // the reset is lazy: the slot is filled with zeros only if it's read before the first scatter.
+        // The flags are bytes, since the slots are acquired concurrently with the inferences updating the other flags
+        std::vector<uint8_t> resetPending;
+    };
+
+    Variable& getVariable(const std::string& variableId);
+    void checkSlot(int slot) const;
+
+    dnnl::engine eng;
+    size_t capacity;
+    std::unordered_map<std::string, Variable> variables;
+    std::vector<bool> used;
+    std::mutex mutex;
 };
 
 }   // namespace intel_cpu
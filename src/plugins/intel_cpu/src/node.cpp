@@ -269,6 +269,15 @@ void Node::selectOptimalPrimitiveDescriptor() {
 }
 
 void Node::selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs) {
+    // the primitive descriptor selected when the model was exported
+    if (auto compiledCache = context->getCompiledCache()) {
+        const int selected = compiledCache->getSelectedPrimitive(*this);
+        if (selected >= 0) {
+            selectPrimitiveDescriptorByIndex(selected);
+            return;
+        }
+    }
+
     for (auto& type : priority) {
         int selectedPrimitive = -1;
         int equalsFormatCount = -1;
@@ -820,7 +829,7 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
 
         Memory memory{engine, newDesc, internalBlob->buffer()};
 
-        MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
+        MemoryPtr _ptr = makeWeightsMemory(engine, intDesc, context->getWeightsAllocator());
         node::Reorder::reorderData(memory, *_ptr, context->getParamsCache());
         return _ptr;
     };
@@ -880,8 +889,14 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     }
 
     auto create = [&] () {
+        // the weights reordered when the model was exported are used in place
+        if (auto compiledCache = context->getCompiledCache()) {
+            if (auto importedWeights = compiledCache->getWeights(getName(), dstWeightDesc))
+                return importedWeights;
+        }
+
         Memory srcMemory{ getEngine(), srcWeightDesc, edgeMem->getData() };
-        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
+        MemoryPtr _ptr = makeWeightsMemory(getEngine(), dstWeightDesc, context->getWeightsAllocator());
         node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
 
         return _ptr;
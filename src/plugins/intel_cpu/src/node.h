@@ -342,6 +342,17 @@ public:
               typename std::enable_if<std::is_base_of<MemoryDesc, T>::value, int>::type = 0>
     std::shared_ptr<T> getOutputMemDescAtPort(size_t portNum) const;
 
+    int getSelectedPrimitiveDescriptorIndex() const {
+        return selectedPrimitiveDescriptorIndex;
+    }
+
+    /**
+     * @brief Returns the constant weights reordered to the layouts of the node primitives, the key is the layout
+     */
+    const std::unordered_map<std::string, MemoryPtr>& getPreparedWeights() const {
+        return privateWeightCache;
+    }
+
     void selectPrimitiveDescriptorByIndex(int index) {
         if (index < 0 || static_cast<size_t>(index) >= supportedPrimitiveDescriptors.size())
             selectedPrimitiveDescriptorIndex = -1;
@@ -356,6 +367,8 @@ public:
     std::string getPrimitiveDescriptorType() const;
 
     PerfCount &PerfCounter() { return perfCounter; }
+    // time spent in prepareParams() of a dynamic node
+    PerfCount &PerfPrepareCounter() { return perfPrepareCounter; }
 
     virtual void resolveInPlaceEdges(Edge::LOOK look = Edge::LOOK_BOTH);
 
@@ -399,6 +412,10 @@ public:
         return execIndex;
     }
 
+    int getScratchpadLane() const {
+        return scratchpadLane;
+    }
+
     const std::string & getTypeStr() const {
         return typeStr;
     }
@@ -685,7 +702,7 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            context->getScratchPad(scratchpadLane)->updateScratchPadMem(scratchpadMem, desc);
         }
         return scratchpadMem;
     }
@@ -713,9 +730,12 @@ private:
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
+    PerfCount perfPrepareCounter;
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    // index of the scratch pad used by the node, assigned by the inter-op scheduler
+    int scratchpadLane = 0;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
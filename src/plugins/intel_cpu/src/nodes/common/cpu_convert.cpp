@@ -555,6 +555,28 @@ struct ConvertFromBinPrecision {
     }
 };
 
+struct ConvertFrom4BitContext {
+    const void *srcPtr;
+    void *dstPtr;
+    size_t size;
+    bool isSigned;
+    bool converted;
+};
+
+template<typename T>
+struct ConvertFrom4BitPrecision {
+    void operator()(ConvertFrom4BitContext &ctx) {
+        auto src = static_cast<const uint8_t *>(ctx.srcPtr);
+        auto dst = static_cast<T *>(ctx.dstPtr);
+        // the first value of a byte is stored in the high nibble
+        parallel_for(ctx.size, [&](size_t i) {
+            const uint8_t nibble = (src[i / 2] >> (i % 2 ? 0 : 4)) & 0xF;
+            dst[i] = static_cast<T>(ctx.isSigned ? (nibble ^ 8) - 8 : nibble);
+        });
+        ctx.converted = true;
+    }
+};
+
 
 void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
     cpu_convert(srcPtr, dstPtr, srcPrc, dstPrc, dstPrc, size);
@@ -597,6 +619,17 @@ void cpu_convert(const void *srcPtr,
         if (!ctx.converted)
             IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " <bitsSize == " << srcPrc.bitsSize()
                                                              << "> precision to: " << dstPrc;
+    } else if (one_of(srcPrc, Precision::U4, Precision::I4)) {
+        ConvertFrom4BitContext ctx {
+                srcPtr,
+                dstPtr,
+                size,
+                srcPrc == Precision::I4,
+                false
+        };
+        OV_SWITCH(intel_cpu, ConvertFrom4BitPrecision, ctx, dstPrc, INTEL_CPU_CVT_FROM_BIN_LIST);
+        if (!ctx.converted)
+            IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
     } else {
         ConvertContext ctx {
             srcPtr,
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "int4_weights_gemm.h"
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+#include <oneapi/dnnl/dnnl.hpp>
+#include "utils/general_utils.h"
+#include "nodes/kernels/x64/int4_weights_kernel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// the decompression parameters are set per tensor, per output channel or per group of each output channel
+inline size_t paramIdx(size_t count, size_t oc, size_t g, size_t OC, size_t groups) {
+    if (count == 1)
+        return 0;
+    return count == OC * groups ? oc * groups + g : oc;
+}
+
+inline float weightValue(const uint8_t* weights, size_t idx, bool isSigned) {
+    const uint8_t nibble = idx % 2 ? weights[idx / 2] & 0xF : weights[idx / 2] >> 4;
+    return static_cast<float>(isSigned ? (nibble ^ 8) - 8 : nibble);
+}
+
+}   // namespace
+
+Int4WeightsGemm::Int4WeightsGemm(size_t OC, size_t IC, size_t groupSize, bool isSigned, bool withZeroPoints)
+    : OC(OC), IC(IC), isSigned(isSigned), withZeroPoints(withZeroPoints) {
+    this->groupSize = (groupSize == 0 || groupSize > IC) ? IC : groupSize;
+    groups = div_up(IC, this->groupSize);
+    threads = static_cast<size_t>(parallel_get_max_threads());
+
+#if defined(OPENVINO_ARCH_X86_64)
+    jInt4WeightsConfParams jcp;
+    jcp.isSigned = isSigned;
+    jcp.withZeroPoint = withZeroPoints;
+    if (mayiuse(cpu::x64::avx512_core)) {
+        kernel.reset(new jitUniInt4WeightsKernel<cpu::x64::avx512_core>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jitUniInt4WeightsKernel<cpu::x64::avx2>(jcp));
+    }
+    if (kernel)
+        kernel->create_ker();
+#endif // OPENVINO_ARCH_X86_64
+}
+
+size_t Int4WeightsGemm::getWorkspaceSize(size_t M) const {
+    // a tile of the decompressed weights per thread
+    return threads * getTileRows(M) * IC;
+}
+
+void Int4WeightsGemm::decompressRow(const uint8_t* weights, size_t oc,
+                                    const float* scales, size_t scalesCount,
+                                    const float* zeroPoints, size_t zeroPointsCount,
+                                    float* row) const {
+    const size_t rowIdx = oc * IC;
+    for (size_t g = 0; g < groups; g++) {
+        const float scale = scales[paramIdx(scalesCount, oc, g, OC, groups)];
+        const float zeroPoint = withZeroPoints ? zeroPoints[paramIdx(zeroPointsCount, oc, g, OC, groups)] : 0.f;
+        const size_t icEnd = std::min(IC, (g + 1) * groupSize);
+        size_t ic = g * groupSize;
+        // the kernel starts at a byte boundary, the groups of the odd IC or group size start in the low nibble
+        // every other time
+        if (kernel && (rowIdx + ic) % 2 == 0) {
+            jInt4WeightsCallArgs args;
+            args.weights = weights + (rowIdx + ic) / 2;
+            args.dst = row + ic;
+            args.scale = scale;
+            args.zeroPoint = zeroPoint;
+            args.count = (icEnd - ic) / kernel->step * kernel->step;
+            (*kernel)(&args);
+            ic += args.count;
+        }
+        for (; ic < icEnd; ic++)
+            row[ic] = (weightValue(weights, rowIdx + ic, isSigned) - zeroPoint) * scale;
+    }
+}
+
+void Int4WeightsGemm::execute(const float* src,
+                              const uint8_t* weights,
+                              const float* scales, size_t scalesCount,
+                              const float* zeroPoints, size_t zeroPointsCount,
+                              const float* bias,
+                              float* dst,
+                              size_t M,
+                              float* workspace) const {
+    std::atomic<bool> gemmFailed{false};
+    const size_t tileRows = getTileRows(M);
+    const size_t tiles = div_up(OC, tileRows);
+    parallel_nt(static_cast<int>(threads), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(tiles, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        // the decompressed weights of a tile of output channels
+        float* tile = workspace + ithr * tileRows * IC;
+        for (size_t t = start; t < end && !gemmFailed; t++) {
+            const size_t oc0 = t * tileRows;
+            const size_t n = std::min(OC - oc0, tileRows);
+            for (size_t l = 0; l < n; l++)
+                decompressRow(weights, oc0 + l, scales, scalesCount, zeroPoints, zeroPointsCount, tile + l * IC);
+
+            // oneDNN sgemm switches to its gemv kernels for a single row of src
+            if (dnnl::sgemm('N', 'T', M, n, IC, 1.f, src, IC, tile, IC, 0.f, dst + oc0, OC) != dnnl::status::success) {
+                gemmFailed = true;
+                return;
+            }
+            if (bias) {
+                for (size_t m = 0; m < M; m++) {
+                    for (size_t l = 0; l < n; l++)
+                        dst[m * OC + oc0 + l] += bias[oc0 + l];
+                }
+            }
+        }
+    });
+
+    if (gemmFailed)
+        IE_THROW() << "Int4WeightsGemm failed to execute the matrix multiplication";
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jitInt4WeightsKernelBase;
+
+/**
+ * @brief Matrix multiplication with the weights compressed to 4 bits and decompressed on the fly:
+ *      dst[M, OC] = src[M, IC] * ((weights[OC, IC] - zeroPoints) * scales)^T + bias
+ * The scales and the zero points are set either per output channel or per group of groupSize input channels of each
+ * output channel ([OC, IC / groupSize] layout), a single value is broadcasted.
+ *
+ * The weights are read as the u4/i4 constants store them (two values per byte, the first one in the high nibble),
+ * so no other copy of them is kept. The weights are decompressed by the JIT kernel once per call, by tiles of output
+ * channels, which are multiplied by oneDNN sgemm. The tiles are small for the small M cases, which are memory bound,
+ * so the work is split among more threads.
+ */
+class Int4WeightsGemm {
+public:
+    static constexpr size_t ocBlock = 16;
+    static constexpr size_t ocTile = 64;
+    // the rows of src up to which the weights read dominates the sgemm
+    static constexpr size_t maxGemvRows = 16;
+
+    Int4WeightsGemm(size_t OC, size_t IC, size_t groupSize, bool isSigned, bool withZeroPoints);
+
+    /**
+     * @brief Returns the number of floats of the workspace required to multiply M rows of src
+     */
+    size_t getWorkspaceSize(size_t M) const;
+
+    void execute(const float* src,
+                 const uint8_t* weights,
+                 const float* scales, size_t scalesCount,
+                 const float* zeroPoints, size_t zeroPointsCount,
+                 const float* bias,
+                 float* dst,
+                 size_t M,
+                 float* workspace) const;
+
+private:
+    size_t getTileRows(size_t M) const {
+        return M <= maxGemvRows ? size_t(ocBlock) : size_t(ocTile);
+    }
+    void decompressRow(const uint8_t* weights, size_t oc,
+                       const float* scales, size_t scalesCount,
+                       const float* zeroPoints, size_t zeroPointsCount,
+                       float* row) const;
+
+    size_t OC;
+    size_t IC;
+    size_t groupSize;
+    size_t groups;
+    bool isSigned;
+    bool withZeroPoints;
+    size_t threads;
+    std::shared_ptr<jitInt4WeightsKernelBase> kernel;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
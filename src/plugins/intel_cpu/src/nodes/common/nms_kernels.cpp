@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernels.h"
+
+#include <cmath>
+
+namespace ov {
+namespace intel_cpu {
+
+void NmsBoxes::clear() {
+    x1.clear();
+    y1.clear();
+    x2.clear();
+    y2.clear();
+    areas.clear();
+}
+
+void NmsBoxes::reserve(size_t count) {
+    x1.reserve(count);
+    y1.reserve(count);
+    x2.reserve(count);
+    y2.reserve(count);
+    areas.reserve(count);
+}
+
+void NmsBoxes::add(const float* box, float area) {
+    x1.push_back(box[0]);
+    y1.push_back(box[1]);
+    x2.push_back(box[2]);
+    y2.push_back(box[3]);
+    areas.push_back(area);
+}
+
+// the loops are branchless to be vectorized by the compiler
+void NmsBoxes::iou(const float* box, float boxArea, size_t begin, size_t end, float* dst) const {
+    const float bx1 = box[0], by1 = box[1], bx2 = box[2], by2 = box[3];
+    const float* px1 = x1.data();
+    const float* py1 = y1.data();
+    const float* px2 = x2.data();
+    const float* py2 = y2.data();
+    const float* pAreas = areas.data();
+    const bool boxValid = boxArea > 0.f;
+    for (size_t j = begin; j < end; j++) {
+        const float width = std::max(std::min(bx2, px2[j]) - std::max(bx1, px1[j]) + offset, 0.f);
+        const float height = std::max(std::min(by2, py2[j]) - std::max(by1, py1[j]) + offset, 0.f);
+        const float inter = width * height;
+        bool valid = boxValid && pAreas[j] > 0.f;
+        if (checkOverlap)
+            valid = valid && px1[j] <= bx2 && px2[j] >= bx1 && py1[j] <= by2 && py2[j] >= by1;
+        dst[j - begin] = valid ? inter / (boxArea + pAreas[j] - inter) : 0.f;
+    }
+}
+
+float NmsBoxes::maxIou(const float* box, float boxArea, size_t count) const {
+    float iouBlock[block];
+    float result = 0.f;
+    for (size_t begin = 0; begin < count; begin += block) {
+        const size_t end = std::min(begin + block, count);
+        iou(box, boxArea, begin, end, iouBlock);
+        for (size_t i = 0; i < end - begin; i++)
+            result = std::max(result, iouBlock[i]);
+    }
+    return result;
+}
+
+float nmsMinDecayLinear(const float* iou, const float* iouMax, size_t count) {
+    float result = 1.f;
+    for (size_t j = 0; j < count; j++)
+        result = std::min(result, (1.f - iou[j]) / (1.f - iouMax[j] + 1e-10f));
+    return result;
+}
+
+float nmsMinDecayGaussian(const float* iou, const float* iouMax, size_t count, float sigma) {
+    float result = 1.f;
+    for (size_t j = 0; j < count; j++)
+        result = std::min(result, std::exp((iouMax[j] * iouMax[j] - iou[j] * iou[j]) * sigma));
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The boxes stored by coordinates (structure of arrays), so the overlaps of a box with many boxes are computed
+ * by the vectorizable loops. The box is [x1, y1, x2, y2] (or [y1, x1, y2, x2], the IoU doesn't depend on the order of the axes).
+ *
+ * The IoU of the boxes with the areas supplied by the caller is
+ *      iou = inter / (area1 + area2 - inter), inter = max(min(x2) - max(x1) + offset, 0) * max(min(y2) - max(y1) + offset, 0)
+ * and it is zero when any of the areas is not positive or, with checkOverlap, when the boxes don't overlap.
+ */
+class NmsBoxes {
+public:
+    explicit NmsBoxes(float offset = 0.f, bool checkOverlap = false) : offset(offset), checkOverlap(checkOverlap) {}
+
+    void clear();
+    void reserve(size_t count);
+    size_t size() const {
+        return x1.size();
+    }
+
+    void add(const float* box, float area);
+
+    /**
+     * @brief The area of the box including the coordinates offset, negative for the inverted boxes
+     */
+    static float area(const float* box, float offset) {
+        return (box[2] - box[0] + offset) * (box[3] - box[1] + offset);
+    }
+
+    /**
+     * @brief Computes the IoU of the box with the boxes [begin, end) into dst
+     */
+    void iou(const float* box, float boxArea, size_t begin, size_t end, float* dst) const;
+
+    /**
+     * @brief The max IoU of the box with the boxes [0, count)
+     */
+    float maxIou(const float* box, float boxArea, size_t count) const;
+
+    /**
+     * @brief Checks if the IoU of the box with any of the boxes [0, count) satisfies the predicate,
+     * the IoU are computed by blocks to stop at the first suppressing box
+     */
+    template <typename Pred>
+    bool any(const float* box, float boxArea, size_t count, const Pred& pred) const {
+        float iouBlock[block];
+        for (size_t begin = 0; begin < count; begin += block) {
+            const size_t end = std::min(begin + block, count);
+            iou(box, boxArea, begin, end, iouBlock);
+            for (size_t i = 0; i < end - begin; i++) {
+                if (pred(iouBlock[i]))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static constexpr size_t block = 32;
+
+    float offset;
+    bool checkOverlap;
+    std::vector<float> x1, y1, x2, y2, areas;
+};
+
+/**
+ * @brief The decay functions of the matrix NMS: the min over j of the decay of the score by the box j
+ * with the IoU iou[j] whose own max IoU with the higher scored boxes is iouMax[j]
+ */
+float nmsMinDecayLinear(const float* iou, const float* iouMax, size_t count);
+float nmsMinDecayGaussian(const float* iou, const float* iouMax, size_t count, float sigma);
+
+/**
+ * @brief Orders the first k elements of the range by the comparator: the pre-selection of the top k candidates
+ * doesn't sort the rest of them, the whole range is sorted in parallel. The long ranges are split between the threads,
+ * each of them selects the top k of its chunk, and the top k of the whole range are selected among these candidates.
+ * The range stays a permutation of its elements.
+ */
+template <typename It, typename Compare>
+void nmsSortTopK(It begin, It end, size_t k, const Compare& comp) {
+    const size_t count = static_cast<size_t>(std::distance(begin, end));
+    if (k >= count) {
+        parallel_sort(begin, end, comp);
+        return;
+    }
+
+    // the candidates of the chunks are gathered in the first chunk, so it must hold chunks * k elements
+    const size_t parallelThreshold = 16384;
+    const size_t chunks = std::min(static_cast<size_t>(parallel_get_max_threads()),
+                                   static_cast<size_t>(std::sqrt(count / std::max(k, static_cast<size_t>(1)))));
+    if (count < parallelThreshold || chunks < 2) {
+        std::partial_sort(begin, begin + k, end, comp);
+        return;
+    }
+
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0, stop = 0;
+        splitter(count, chunks, chunk, start, stop);
+        std::partial_sort(begin + start, begin + start + std::min(k, stop - start), begin + stop, comp);
+    });
+    // the first chunk is the longest one, its own candidates are in place
+    size_t candidates = 0;
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t start = 0, stop = 0;
+        splitter(count, chunks, chunk, start, stop);
+        const size_t selected = std::min(k, stop - start);
+        if (chunk != 0)
+            std::swap_ranges(begin + start, begin + start + selected, begin + candidates);
+        candidates += selected;
+    }
+    std::partial_sort(begin, begin + k, begin + candidates, comp);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -119,15 +119,16 @@ private:
             virtual ~DefConvExecutor() = default;
 
         protected:
-            void prepareSamplingWeights(const float* offsets, const float* modulation = nullptr, bool enforceRef = false);
+            // the sampling buffers are owned by the node, the executor keeps no state between the calls,
+            // so it may be shared by the graphs executed simultaneously
+            void prepareSamplingWeights(const float* offsets, const float* modulation, int *pSampledCoordsVector,
+                                        float *pInterpWeightsVector, bool enforceRef = false);
             jit_def_conv_params jcp = {};
             VectorDims srcStrides;
             VectorDims offStrides;
             VectorDims weiStrides;
             VectorDims modStrides;
             VectorDims dstStrides;
-            int *pSampledCoordsVector;
-            float *pInterpWeightsVector;
     };
 
     class DefConvRefExecutor : public DefConvExecutor {
@@ -2,21 +2,54 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
+#include "input.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+
+using accumulateFunc = void (*)(const jEmbeddingBagCallArgs&);
+
+// the reference of the jit kernel
+template <typename T, typename W>
+void accumulateRef(const jEmbeddingBagCallArgs& args) {
+    const auto* weights = reinterpret_cast<const W*>(args.weights);
+    for (size_t i = 0lu; i < args.indicesNum; i++) {
+        const size_t idx = args.indices[i];
+        const auto* row = reinterpret_cast<const T*>(reinterpret_cast<const uint8_t*>(args.table) + idx * args.rowStrideB);
+        float coef = weights ? static_cast<float>(weights[i]) : 1.f;
+        if (args.scales)
+            coef *= args.scales[idx];
+        const float zeroPoint = args.zeroPoints ? args.zeroPoints[idx] : 0.f;
+        for (size_t j = 0lu; j < args.rowSize; j++)
+            args.dst[j] += coef * (static_cast<float>(row[j]) - zeroPoint);
+    }
+}
+
+template <typename T>
+accumulateFunc getAccumulateRef(const Precision& weightsPrc) {
+    return weightsPrc == Precision::BF16 ? accumulateRef<T, bfloat16_t> : accumulateRef<T, float>;
+}
+
+}   // namespace
+
 EmbeddingBagSum::EmbeddingBagSum(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -39,11 +72,89 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, const Precision& tablePrc, const Precision& dstPrc) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    const size_t rowsNum = indexStaticShape[0];
+    if (_decompressionMultiply.size() == 1lu)
+        _decompressionMultiply.resize(rowsNum, _decompressionMultiply[0]);
+    if (_decompressionSubtract.size() == 1lu)
+        _decompressionSubtract.resize(rowsNum, _decompressionSubtract[0]);
+
+#if defined(OPENVINO_ARCH_X86_64)
+    if (!_jitKernel && one_of(dstPrc, Precision::FP32, Precision::BF16)) {
+        jEmbeddingBagConfParams jcp;
+        jcp.tablePrc = tablePrc;
+        jcp.weightsPrc = dstPrc;
+        jcp.withWeights = _withWeights;
+        jcp.withScales = !_decompressionMultiply.empty();
+        jcp.withZeroPoints = !_decompressionSubtract.empty();
+
+        if (x64::mayiuse(x64::avx512_core)) {
+            _jitKernel.reset(new jitUniEmbeddingBagKernel<x64::avx512_core>(jcp));
+        } else if (x64::mayiuse(x64::avx2)) {
+            _jitKernel.reset(new jitUniEmbeddingBagKernel<x64::avx2>(jcp));
+        }
+        if (_jitKernel)
+            _jitKernel->create_ker();
+    }
+#endif
+}
+
+Precision EmbeddingBagSum::getOutputPrecision(const Precision& tablePrc, const Precision& origOutPrc) const {
+    // the compressed table is decompressed to FP32 or BF16
+    if (withDecompression())
+        return origOutPrc == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    return tablePrc;
+}
+
+void EmbeddingBagSum::fuseDecompressionMultiply(const NodePtr& constData) {
+    fuseDecompressionConstant(constData, _decompressionMultiply);
+}
+
+void EmbeddingBagSum::fuseDecompressionSubtract(const NodePtr& constData) {
+    fuseDecompressionConstant(constData, _decompressionSubtract);
+}
+
+void EmbeddingBagSum::fuseDecompressionConstant(const NodePtr& constData, std::vector<float>& decompressionValues) {
+    auto *constInputNode = dynamic_cast<node::Input *>(constData.get());
+    if (!constInputNode) {
+        IE_THROW() << "Cannot cast " << constData->getName() << " to Input";
+    }
+    auto constBlob = constInputNode->getMemoryPtr();
+    const auto elementsCount = constBlob->getShape().getElementsCount();
+    decompressionValues.resize(elementsCount);
+    cpu_convert(constBlob->getData(),
+                &decompressionValues[0],
+                constBlob->getDesc().getPrecision(),
+                Precision::FP32,
+                elementsCount);
+}
+
+void EmbeddingBagSum::collectBags(size_t bagsNum) {
+    _bags.resize(bagsNum);
+    _bagsCost.resize(bagsNum + 1lu);
+    _bagsCost[0] = 0lu;
+    for (size_t obi = 0lu; obi < bagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        _bagsCost[obi + 1lu] = _bagsCost[obi] + (bag.indices != nullptr ? bag.size : 0lu) + 1lu;
+    }
+}
+
+void EmbeddingBagSum::splitBags(const int nthr, const int ithr, size_t& start, size_t& end) const {
+    // the skewed bag sizes make the split by the number of the bags unbalanced
+    const size_t totalCost = _bagsCost.back();
+    auto bagAt = [&](size_t cost) {
+        return static_cast<size_t>(std::lower_bound(_bagsCost.begin(), _bagsCost.end(), cost) - _bagsCost.begin());
+    };
+    start = bagAt(totalCost * ithr / nthr);
+    end = bagAt(totalCost * (ithr + 1) / nthr);
 }
 
 template<typename T>
@@ -51,29 +162,23 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
-    initFromInputs();
-
-    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->getData());
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitBags(nthr, ithr, start, end);
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
-
         for (size_t obi = start; obi < end; obi++) {
             size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const auto& bag = _bags[obi];
+            const int* indices = bag.indices;
+            const size_t indicesSize = bag.size;
+            int weightsIdx = bag.weightsIdx;
+            const bool withWeights = bag.withWeights;
 
             if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
                 size_t inIdx = 0lu;
                 if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
                     IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
@@ -119,13 +224,84 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processFloatData(const uint8_t* srcData, const uint8_t* weightsData, const Precision& srcPrc,
+                                       const Precision& dstPrc, const InferenceEngine::SizeVector& inDataDims,
+                                       const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    accumulateFunc accumulate = nullptr;
+    if (!_jitKernel) {
+        switch (srcPrc) {
+            case Precision::FP32: accumulate = getAccumulateRef<float>(dstPrc); break;
+            case Precision::BF16: accumulate = getAccumulateRef<bfloat16_t>(dstPrc); break;
+            case Precision::U8: accumulate = getAccumulateRef<uint8_t>(dstPrc); break;
+            case Precision::I8: accumulate = getAccumulateRef<int8_t>(dstPrc); break;
+            default:
+                IE_THROW() << msgPrefix << "does not support the table precision '" << srcPrc.name() << "'";
+        }
+    }
+
+    auto *dstData = reinterpret_cast<uint8_t *>(outMemory->getData());
+    const bool dstFP32 = dstPrc == Precision::FP32;
+    if (!dstFP32)
+        _accumulators.resize(_embDepth * parallel_get_max_threads());
+
+    jEmbeddingBagCallArgs baseArgs;
+    baseArgs.table = srcData;
+    baseArgs.scales = _decompressionMultiply.empty() ? nullptr : _decompressionMultiply.data();
+    baseArgs.zeroPoints = _decompressionSubtract.empty() ? nullptr : _decompressionSubtract.data();
+    baseArgs.rowSize = _embDepth;
+    baseArgs.rowStrideB = _embDepth * srcPrc.size();
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitBags(nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        for (size_t obi = start; obi < end; obi++) {
+            const auto& bag = _bags[obi];
+            float* acc = dstFP32 ? reinterpret_cast<float*>(dstData) + obi * _embDepth : &_accumulators[ithr * _embDepth];
+            std::fill(acc, acc + _embDepth, 0.f);
+
+            if (bag.indices != nullptr) {
+                for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                    if (static_cast<size_t>(bag.indices[inIdx]) >= inDataDims[0]) {
+                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]);
+                    }
+                }
+
+                auto args = baseArgs;
+                args.indices = bag.indices;
+                args.indicesNum = bag.size;
+                args.weights = bag.withWeights ? weightsData + bag.weightsIdx * dstPrc.size() : nullptr;
+                args.dst = acc;
+                if (_jitKernel) {
+                    (*_jitKernel)(&args);
+                } else {
+                    accumulate(args);
+                }
+            }
+
+            if (!dstFP32)
+                cpu_convert(acc, dstData + obi * _embDepth * dstPrc.size(), Precision::FP32, dstPrc, _embDepth);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    initFromInputs();
+    collectBags(outMemory->getShape().getStaticDims()[0]);
+
+    const auto dstPrc = outMemory->getDesc().getPrecision();
+    if (one_of(dstPrc, Precision::FP32, Precision::BF16)) {
+        return processFloatData(srcData, weightsData, srcPrc, dstPrc, inDims, outMemory);
+    }
+
     switch (srcPrc) {
-        case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), inDims, outMemory);
-        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), inDims, outMemory);
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/x64/embedding_bag_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -28,6 +29,14 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    // the row-wise decompression of the compressed table fused by the graph optimizer:
+    // the table is decompressed by the node as (table - subtract) * multiply, the per tensor values are broadcasted
+    void fuseDecompressionMultiply(const NodePtr& constData);
+    void fuseDecompressionSubtract(const NodePtr& constData);
+    bool withDecompression() const {
+        return !_decompressionMultiply.empty();
+    }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -37,11 +46,19 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrc,
+                       const InferenceEngine::Precision& dstPrc);
+    // the precision of the output and of the per sample weights
+    InferenceEngine::Precision getOutputPrecision(const InferenceEngine::Precision& tablePrc,
+                                                  const InferenceEngine::Precision& origOutPrc) const;
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    // the rows are accumulated in FP32 for the FP32 and BF16 outputs
+    void processFloatData(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision& srcPrc,
+                          const InferenceEngine::Precision& dstPrc, const InferenceEngine::SizeVector& inDataDims,
+                          const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +68,30 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    struct Bag {
+        const int* indices = nullptr;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    void collectBags(size_t bagsNum);
+    // the bags of the thread, the threads get the equal number of the indices rather than the bags
+    void splitBags(const int nthr, const int ithr, size_t& start, size_t& end) const;
+    void fuseDecompressionConstant(const NodePtr& constData, std::vector<float>& decompressionValues);
+
+    std::vector<Bag> _bags;
+    // the number of the indices before each bag, every bag costs one more index for the initialization
+    std::vector<size_t> _bagsCost;
+
+    std::vector<float> _decompressionMultiply;
+    std::vector<float> _decompressionSubtract;
+    // the FP32 accumulators of the threads for the BF16 output
+    std::vector<float> _accumulators;
+
+    std::shared_ptr<jitEmbeddingBagKernelBase> _jitKernel;
 };
 
 }   // namespace node
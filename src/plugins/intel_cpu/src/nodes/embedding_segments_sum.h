@@ -47,6 +47,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+    // the first index and the number of the indices of each segment
+    std::vector<size_t> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace node
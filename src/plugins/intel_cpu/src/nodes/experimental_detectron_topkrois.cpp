@@ -9,6 +9,7 @@
 #include <ngraph/opsets/opset6.hpp>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include "common/nms_kernels.h"
 #include "experimental_detectron_topkrois.h"
 
 using namespace InferenceEngine;
@@ -73,8 +74,10 @@ void ExperimentalDetectronTopKROIs::execute(dnnl::stream strm) {
 
     std::vector<size_t> idx(input_rois_num);
     iota(idx.begin(), idx.end(), 0);
-    // FIXME. partial_sort is enough here.
-    sort(idx.begin(), idx.end(), [&input_probs](size_t i1, size_t i2) {return input_probs[i1] > input_probs[i2];});
+    // only the top_rois_num ROIs are ordered, the equal probabilities keep the order of the ROIs
+    nmsSortTopK(idx.begin(), idx.end(), top_rois_num, [&input_probs](size_t i1, size_t i2) {
+        return input_probs[i1] > input_probs[i2] || (input_probs[i1] == input_probs[i2] && i1 < i2);
+    });
 
     for (int i = 0; i < top_rois_num; ++i) {
         cpu_memcpy(output_rois + 4 * i, input_rois + 4 * idx[i], 4 * sizeof(float));
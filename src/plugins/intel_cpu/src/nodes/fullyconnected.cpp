@@ -198,7 +198,10 @@ void FullyConnected::getSupportedDescriptors() {
     if (!fusedWith.empty()) {
         outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0));
     }
-    auto weightsDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(WEIGHTS_ID));
+    // oneDNN has no 4-bit data type, such weights are decompressed by the node itself
+    const bool int4Weights = one_of(getOriginalInputPrecisionAtPort(WEIGHTS_ID), Precision::U4, Precision::I4);
+    auto weightsDataType = int4Weights ? memory::data_type::undef
+                                       : DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(WEIGHTS_ID));
 
     withBiases = getOriginalInputsNumber() == 3;
 
@@ -243,6 +246,20 @@ void FullyConnected::getSupportedDescriptors() {
 
     inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
     outDims = isDynamicNode() ? makeDummyOutputDims(inDims) : getOutputShapeAtPort(0).getStaticDims();
+
+    // the node kernel doesn't support post-ops, nothing is fused to the FC with 4-bit weights
+    useInt4WeightsDecompression = int4Weights && !decompressionMultiply.empty() && fusedWith.empty() &&
+                                  !weightsNonTransposed && !useSparseWeights &&
+                                  one_of(inputDataType, memory::data_type::f32, memory::data_type::bf16) &&
+                                  getInputShapeAtPort(WEIGHTS_ID).getRank() == 2;
+    if (useInt4WeightsDecompression) {
+        useWeightsDecompressionImpl = false;
+        return;
+    }
+    if (requiresInt4WeightsDecompression())
+        IE_THROW() << errorPrefix << " has 4-bit weights which are not decompressed by the node: "
+                   << "KeepInt4WeightsPrecision marked a pattern that FuseFCAndWeightsDecompression didn't fuse";
+
 #if defined(OV_CPU_WITH_MLAS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
     // MLAS doesn't support post-ops fusing and only supports FP32. INT8 is not enabled yet
     // Disable MLAS when FC could fuse post-ops
@@ -299,8 +316,9 @@ void FullyConnected::prepackMLASWeight() {
             float* weightPtr = reinterpret_cast<float*>(weightsMem->getData());
             size_t ldb = weightsNonTransposed ? N : K;
             MemoryPtr _ptr =
-                std::make_shared<Memory>(getEngine(),
-                                         intel_cpu::CpuBlockedMemoryDesc(Precision::I8, intel_cpu::Shape{packedBsize}));
+                makeWeightsMemory(getEngine(),
+                                  std::make_shared<CpuBlockedMemoryDesc>(Precision::I8, intel_cpu::Shape{packedBsize}),
+                                  context->getWeightsAllocator());
             float* prepackedDst = reinterpret_cast<float*>(_ptr->getData());
             mlas_sgemm_pack(weightsNonTransposed ? "F" : "T", N, K, ldb, weightPtr, prepackedDst);
             return _ptr;
@@ -330,6 +348,12 @@ void FullyConnected::prepackMLASWeight() {
 #endif
 
 void FullyConnected::createPrimitive() {
+    if (useInt4WeightsDecompression) {
+        // the workspace of the kernel is sized by prepareParams
+        createInt4Gemm();
+        Node::createPrimitive();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         Node::createPrimitive();
@@ -360,6 +384,10 @@ void FullyConnected::prepareParams() {
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    if (useInt4WeightsDecompression) {
+        prepareInt4Params(srcMemPtr, dstMemPtr);
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     // M should be normalized and updated
     if (useMlas) {
@@ -531,7 +559,78 @@ void FullyConnected::executeMLAS() {
 
 #endif
 
+bool FullyConnected::requiresInt4WeightsDecompression() const {
+    return one_of(getOriginalInputPrecisionAtPort(WEIGHTS_ID), Precision::U4, Precision::I4);
+}
+
+void FullyConnected::createInt4Gemm() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+
+    // the kernel reads the weights in place, they are stored by the model constant as is
+    const auto& wgtDims = weightsMem->getStaticDims();
+    const size_t OC = wgtDims[0];
+    const size_t IC = wgtDims[1];
+    const size_t groups = decompressionMultiply.size() > OC ? decompressionMultiply.size() / OC : 1;
+    const bool isSigned = weightsMem->getDesc().getPrecision() == Precision::I4;
+    int4Gemm = std::make_shared<Int4WeightsGemm>(OC, IC, IC / groups, isSigned, !decompressionSubtract.empty());
+}
+
+void FullyConnected::prepareInt4Params(const MemoryPtr& srcMemPtr, const MemoryPtr& dstMemPtr) {
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    int4M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    // the kernel accumulates in f32, bf16 activations are converted on the fly instead of by reorders around the node,
+    // the scratchpad holds the converted src and dst followed by the workspace of the kernel
+    int4SrcOffset = 0;
+    int4DstOffset = srcMemPtr->getDesc().getPrecision() != Precision::FP32 ? int4M * srcDims.back() : 0;
+    int4WorkspaceOffset = int4DstOffset + (dstMemPtr->getDesc().getPrecision() != Precision::FP32 ? int4M * dstDims.back() : 0);
+    const size_t scratchpadSize = int4WorkspaceOffset + int4Gemm->getWorkspaceSize(int4M);
+    auto scratchpadDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{scratchpadSize}));
+    int4ScratchpadMem = getScratchPadMem(scratchpadDesc);
+}
+
+void FullyConnected::executeInt4() {
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto weightsMemPtr = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+
+    const size_t srcSize = int4M * srcMemPtr->getStaticDims().back();
+    const size_t dstSize = int4M * dstMemPtr->getStaticDims().back();
+    const auto srcPrecision = srcMemPtr->getDesc().getPrecision();
+    const auto dstPrecision = dstMemPtr->getDesc().getPrecision();
+    auto* scratchpad = reinterpret_cast<float*>(int4ScratchpadMem->getData());
+
+    const float* src = reinterpret_cast<const float*>(srcMemPtr->getData());
+    if (srcPrecision != Precision::FP32) {
+        cpu_convert(srcMemPtr->getData(), scratchpad + int4SrcOffset, srcPrecision, Precision::FP32, srcSize);
+        src = scratchpad + int4SrcOffset;
+    }
+    float* dst = dstPrecision != Precision::FP32 ? scratchpad + int4DstOffset : reinterpret_cast<float*>(dstMemPtr->getData());
+
+    int4Gemm->execute(src,
+                      reinterpret_cast<const uint8_t*>(weightsMemPtr->getData()),
+                      decompressionMultiply.data(), decompressionMultiply.size(),
+                      decompressionSubtract.empty() ? nullptr : decompressionSubtract.data(), decompressionSubtract.size(),
+                      withBiases ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr,
+                      dst,
+                      int4M,
+                      scratchpad + int4WorkspaceOffset);
+
+    if (dstPrecision != Precision::FP32)
+        cpu_convert(dst, dstMemPtr->getData(), Precision::FP32, dstPrecision, dstSize);
+}
+
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useInt4WeightsDecompression) {
+        executeInt4();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         executeMLAS();
@@ -567,6 +666,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // signed and group-wise decompressed weights are supported only by the kernel without post-ops
+    if (requiresInt4WeightsDecompression())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -773,6 +875,19 @@ void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDes
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
+    if (useInt4WeightsDecompression) {
+        const auto dataPrecision = getOriginalInputPrecisionAtPort(DATA_ID);
+        const auto dstPrecision = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+        const auto weightsPrecision = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+        std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, dataPrecision},
+                                              {LayoutType::ncsp, weightsPrecision}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs,
+                             {{LayoutType::ncsp, dstPrecision}},
+                             impl_desc_type::gemm_any);
+        return;
+    }
     if (useMlas) {
         auto dataPrecision = getOriginalInputPrecisionAtPort(0);
         if (withBiases) {
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "common/int4_weights_gemm.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -122,6 +123,20 @@ private:
     std::vector<float> decompressionSubtract;
     std::vector<float> decompressionMultiply;
 
+    // 4-bit weights decompressed by the node itself (oneDNN has no such weights type)
+    bool useInt4WeightsDecompression = false;
+    std::shared_ptr<Int4WeightsGemm> int4Gemm = nullptr;
+    // the scratchpad holds the f32 src and dst of the bf16 activations and the workspace of the kernel
+    MemoryPtr int4ScratchpadMem = nullptr;
+    size_t int4M = 0;
+    size_t int4SrcOffset = 0;
+    size_t int4DstOffset = 0;
+    size_t int4WorkspaceOffset = 0;
+    bool requiresInt4WeightsDecompression() const;
+    void createInt4Gemm();
+    void prepareInt4Params(const MemoryPtr& srcMemPtr, const MemoryPtr& dstMemPtr);
+    void executeInt4();
+
     // FC with transposed weights
     bool weightsNonTransposed = false;
     DnnlMemoryDescPtr makeTransposedWeightDescriptor();
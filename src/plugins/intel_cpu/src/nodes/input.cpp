@@ -20,6 +20,7 @@
 #include "common/cpu_convert.h"
 #include "utils/cpu_utils.hpp"
 #include <cpu/x64/jit_generator.hpp>
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "shape_inference/shape_inference_pass_through.hpp"
 
@@ -268,6 +269,14 @@ void Input::cloneBlobIfRequired() {
     Shape shape(constOp->get_shape().empty() ? ngraph::Shape(1, 1) : constOp->get_shape());
     const auto prec = convertPrecision(constOp->get_element_type());
     const size_t size = shape.getElementsCount();
+
+    // the 4-bit weights are decompressed by the consumers (oneDNN has no such data type), they are used in place
+    // as the constant stores them, two values per byte
+    if (one_of(prec, Precision::U4, Precision::I4)) {
+        memoryPtr = std::make_shared<Memory>(getEngine(), std::make_shared<CpuBlockedMemoryDesc>(prec, shape), constOp->get_data_ptr());
+        return;
+    }
+
     DnnlBlockedMemoryDesc memDesc(prec, shape);
 
     bool needFlushDenormalsToZero = true;
@@ -385,17 +394,28 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // IRs already have all subnormals flushed to zero, but in
+    // read_model scenario with directly loaded original model still can have subnormals
+    auto canUseBlobInPlace = [&] () {
+        return constOp->get_byte_size() >= memDesc.getCurrentMemSize() &&
+               isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA();
+    };
+
+    // the constant data may be backed by the mapped model file (ov::enable_mmap), it is used in place whenever possible,
+    // so the nodes that use the weights as is don't keep private copies of them
+    auto createBlob = [&, this] () -> MemoryPtr {
+        if (canUseBlobInPlace())
+            return std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+        return cloneBlob();
+    };
+
     auto weightCache = context->getWeightsCache();
 
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), createBlob);
         memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
-    // IRs already have all subnormals flushed to zero, but in
-    // read_model scenario with directly loaded original model still can have subnormals
-    } else if (isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
-        memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
     } else {
-        memoryPtr = std::const_pointer_cast<const IMemory>(cloneBlob());
+        memoryPtr = std::const_pointer_cast<const IMemory>(createBlob());
     }
 }
 
@@ -2349,6 +2349,14 @@ void Interpolate::prepareParams() {
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 
+    const auto pillowWorkingBufSize = execPtr->getPillowWorkingBufSize();
+    if (pillowWorkingBufSize > 0) {
+        auto pillowWorkingBufDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{pillowWorkingBufSize}));
+        pillowWorkingBufMem = getScratchPadMem(pillowWorkingBufDesc);
+    } else {
+        pillowWorkingBufMem = nullptr;
+    }
+
     lastOutputDims = dstDimsOrign;
 }
 
@@ -2520,7 +2528,8 @@ void Interpolate::execute(dnnl::stream strm) {
             src_data = src_data_origin;
         }
 
-        execPtr->exec(src_data, dst_data, postOpsDataPtrs.data());
+        uint8_t *work_buf = pillowWorkingBufMem ? reinterpret_cast<uint8_t*>(pillowWorkingBufMem->getData()) : nullptr;
+        execPtr->exec(src_data, dst_data, postOpsDataPtrs.data(), work_buf);
     } else if (aclExecPtr) {
         aclExecPtr->exec({srcMemPtr}, {dstMemPtr}, postOpsDataPtrs.data());
     } else {
@@ -2797,7 +2806,7 @@ void Interpolate::InterpolateJitExecutor::cubicPlanar(const uint8_t *in_ptr_, ui
 }
 
 void Interpolate::InterpolateJitExecutor::pillowCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_,
-                                                                        int B, int C, int IH, int IW, int OH, int OW) {
+                                                          uint8_t *work_buf_, int B, int C, int IH, int IW, int OH, int OW) {
     // workBuffer needed when both pass are true
     bool xPass = IW != OW;
     bool yPass = IH != OH;
@@ -2810,10 +2819,10 @@ void Interpolate::InterpolateJitExecutor::pillowCGathered(const uint8_t *in_ptr_
             size_t parallelNum = B;
             // IH * OW * C buf needed
             if (parallelNum < threadsNum) {
-                arg.src_ptr[1] = static_cast<uint8_t*>(&pillow_working_buf[(b * OW * IH * C) * srcDataSize]);
+                arg.src_ptr[1] = static_cast<uint8_t*>(&work_buf_[(b * OW * IH * C) * srcDataSize]);
             } else {
                 size_t threadsIdx = parallel_get_thread_num();
-                arg.src_ptr[1] = static_cast<uint8_t*>(&pillow_working_buf[(threadsIdx * OW * IH * C) * srcDataSize]);
+                arg.src_ptr[1] = static_cast<uint8_t*>(&work_buf_[(threadsIdx * OW * IH * C) * srcDataSize]);
             }
         }
         arg.dst = out_ptr_ + (OW * OH * C * b) * dstDataSize;
@@ -3651,7 +3660,8 @@ void Interpolate::InterpolateRefExecutor::linearInterpolation(const uint8_t *in_
     });
 }
 
-void Interpolate::InterpolateRefExecutor::pillowRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int IH, int IW, int OH, int OW) {
+void Interpolate::InterpolateRefExecutor::pillowRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, uint8_t *work_buf_,
+                                                   int B, int C, int IH, int IW, int OH, int OW) {
     size_t offset = 0;
     int filterLenX = auxTable[offset];
     int filterLenY = auxTable[offset + 1];
@@ -3689,12 +3699,12 @@ void Interpolate::InterpolateRefExecutor::pillowRef(const uint8_t *in_ptr_, uint
             size_t parallelNum = B * C;
             // IH * OW buf needed
             if (parallelNum < threadsNum) {
-                xpass_out_ptr_nc = static_cast<uint8_t*>(&pillow_working_buf[(OW * IH * C * b + OW * IH * c) * srcDataSize]);
-                ypass_in_ptr_nc = static_cast<const uint8_t*>(&pillow_working_buf[(OW * IH * C * b + OW * IH * c) * srcDataSize]);
+                xpass_out_ptr_nc = static_cast<uint8_t*>(&work_buf_[(OW * IH * C * b + OW * IH * c) * srcDataSize]);
+                ypass_in_ptr_nc = static_cast<const uint8_t*>(&work_buf_[(OW * IH * C * b + OW * IH * c) * srcDataSize]);
             } else {
                 size_t threadsIdx = parallel_get_thread_num();
-                xpass_out_ptr_nc = static_cast<uint8_t*>(&pillow_working_buf[(threadsIdx * OW * IH) * srcDataSize]);
-                ypass_in_ptr_nc = static_cast<const uint8_t*>(&pillow_working_buf[(threadsIdx * OW * IH) * srcDataSize]);
+                xpass_out_ptr_nc = static_cast<uint8_t*>(&work_buf_[(threadsIdx * OW * IH) * srcDataSize]);
+                ypass_in_ptr_nc = static_cast<const uint8_t*>(&work_buf_[(threadsIdx * OW * IH) * srcDataSize]);
             }
         } else if (xPass && !yPass) {
             xpass_out_ptr_nc = out_ptr_nc;
@@ -3745,12 +3755,14 @@ void Interpolate::InterpolateRefExecutor::pillowRef(const uint8_t *in_ptr_, uint
     });
 }
 
-void Interpolate::InterpolateExecutorBase::create_pillow_working_buf(InterpolateLayoutType layout) {
+size_t Interpolate::InterpolateExecutorBase::getPillowWorkingBufSize() const {
+    if (mode != InterpolateMode::bilinear_pillow && mode != InterpolateMode::bicubic_pillow)
+        return 0;
     if (srcDimPad5d[3] == dstDim5d[3] || srcDimPad5d[4] == dstDim5d[4])
-        return;
+        return 0;
     size_t bufSize = srcDimPad5d[3] * dstDim5d[4] * srcDataSize; // IH * OW
-    size_t threadsNum = parallel_get_num_threads();
-    if (layout == InterpolateLayoutType::planar) {
+    size_t threadsNum = parallel_get_max_threads();
+    if (configured_for_layout == InterpolateLayoutType::planar) {
         // B and C execute in parallel, need separate buf
         size_t parallelNum = srcDimPad5d[0] * srcDimPad5d[1];
         bufSize *= std::min(threadsNum, parallelNum);
@@ -3760,7 +3772,7 @@ void Interpolate::InterpolateExecutorBase::create_pillow_working_buf(Interpolate
         size_t parallelNum = srcDimPad5d[0];
         bufSize *= std::min(threadsNum, parallelNum);
     }
-    pillow_working_buf.resize(bufSize);
+    return bufSize;
 }
 
 Interpolate::InterpolateExecutorBase::InterpolateExecutorBase(const InterpolateAttrs& interpAttrs,
@@ -3797,9 +3809,6 @@ Interpolate::InterpolateExecutorBase::InterpolateExecutorBase(const InterpolateA
         case InterpolateMode::bilinear_pillow:
         case InterpolateMode::bicubic_pillow: {
             buildTblPillow(srcDimPad5d, dstDim5d, dataScales, interpAttrs.cubeCoeff, interpAttrs.layout);
-            if ((srcDimPad5d[4] != dstDim5d[4]) && (srcDimPad5d[3] != dstDim5d[3])) {
-                create_pillow_working_buf(interpAttrs.layout);
-            }
             break;
         }
         default: {
@@ -3859,7 +3868,7 @@ Interpolate::InterpolateJitExecutor::InterpolateJitExecutor(const InterpolateAtt
     }
 }
 
-void Interpolate::InterpolateJitExecutor::exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) {
+void Interpolate::InterpolateJitExecutor::exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, uint8_t *work_buf_) {
     size_t N = srcDimPad5d[0], C = srcDimPad5d[1], ID = srcDimPad5d[2], IH = srcDimPad5d[3], IW = srcDimPad5d[4];
     size_t OD = dstDim5d[2], OH = dstDim5d[3], OW = dstDim5d[4];
 
@@ -3894,7 +3903,7 @@ void Interpolate::InterpolateJitExecutor::exec(const uint8_t *in_ptr_, uint8_t *
         case InterpolateMode::bilinear_pillow:
         case InterpolateMode::bicubic_pillow: {
             if (configured_for_layout == InterpolateLayoutType::by_channel) {
-                pillowCGathered(in_ptr_, out_ptr_, post_ops_data_, N, C, IH, IW, OH, OW);
+                pillowCGathered(in_ptr_, out_ptr_, post_ops_data_, work_buf_, N, C, IH, IW, OH, OW);
             } else {
                 IE_THROW() << "Only channel_first jit kernel is supported for pillow mode" << mode;
             }
@@ -3906,7 +3915,7 @@ void Interpolate::InterpolateJitExecutor::exec(const uint8_t *in_ptr_, uint8_t *
     }
 }
 
-void Interpolate::InterpolateRefExecutor::exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) {
+void Interpolate::InterpolateRefExecutor::exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, uint8_t *work_buf_) {
     size_t N = srcDimPad5d[0], C = srcDimPad5d[1], ID = srcDimPad5d[2], IH = srcDimPad5d[3], IW = srcDimPad5d[4];
     size_t OD = dstDim5d[2], OH = dstDim5d[3], OW = dstDim5d[4];
 
@@ -3935,7 +3944,7 @@ void Interpolate::InterpolateRefExecutor::exec(const uint8_t *in_ptr_, uint8_t *
         }
         case InterpolateMode::bilinear_pillow:
         case InterpolateMode::bicubic_pillow: {
-            pillowRef(in_ptr_, out_ptr_, N, C, IH, IW, OH, OW);
+            pillowRef(in_ptr_, out_ptr_, work_buf_, N, C, IH, IW, OH, OW);
             break;
         }
         default: {
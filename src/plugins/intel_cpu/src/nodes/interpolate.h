@@ -118,9 +118,11 @@ private:
                                 const VectorDims &dstDims,
                                 const std::vector<float> &dataScales);
 
-            virtual void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) = 0;
+            virtual void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, uint8_t *work_buf_) = 0;
             virtual ~InterpolateExecutorBase() = default;
             VectorDims getSrcDimPad5d() const { return srcDimPad5d; }
+            // the executor may be shared by the graphs executed simultaneously, so the working buffer is provided by the caller
+            size_t getPillowWorkingBufSize() const;
 
         private:
             void buildTblNN(const SizeVector& srcDimPad5d, const SizeVector& dstDim5d, const std::vector<float>& dataScales,
@@ -140,7 +142,6 @@ private:
             std::vector<float> getCubicCoeffs(float mantissa, float a);
             static float getPillowBilinearCoeffs(float m);
             static float getPillowBicubicCoeffs(float m);
-            inline void create_pillow_working_buf(InterpolateLayoutType layout);
 
         protected:
             InterpolateMode mode;
@@ -152,9 +153,9 @@ private:
             int spatialDimSize;
             size_t dataRank;
             std::vector<int> auxTable;
-            std::vector<uint8_t> pillow_working_buf;
     };
     std::shared_ptr<InterpolateExecutorBase> execPtr = nullptr;
+    MemoryPtr pillowWorkingBufMem = nullptr;
 
     class InterpolateJitExecutor : public InterpolateExecutorBase {
         public:
@@ -164,7 +165,7 @@ private:
                                    const std::vector<float> &dataScales,
                                    const dnnl::primitive_attr &attr);
 
-            void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
+            void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, uint8_t *work_buf_) override;
 
         private:
             // nearest neighbor
@@ -186,7 +187,7 @@ private:
                 int B, int C, int IH, int IW, int OH, int OW);
 
             // pillow bilinear and pillow bicubic
-            void pillowCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_,
+            void pillowCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, uint8_t *work_buf_,
                 int B, int C, int IH, int IW, int OH, int OW);
 
         private:
@@ -202,7 +203,7 @@ private:
                 InterpolateExecutorBase(interpAttrs, srcDims, dstDims, _dataScales),
                 antialias(interpAttrs.antialias), dataScales(_dataScales) {}
 
-            void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
+            void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, uint8_t *work_buf_) override;
 
         private:
             void NNRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW, int OD, int OH, int OW);
@@ -211,7 +212,7 @@ private:
             void cubicRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int IH, int IW, int OH, int OW);
             void linearInterpolation(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW,
                                       float fx, float fy, float fz, int OD, int OH, int OW, int kernel_width, bool antialias);
-            void pillowRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int IH, int IW, int OH, int OW);
+            void pillowRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, uint8_t *work_buf_, int B, int C, int IH, int IW, int OH, int OW);
 
             static float getValue(const uint8_t *base, size_t offset, InferenceEngine::Precision prec);
             static void setValue(uint8_t *base, size_t offset, float value, InferenceEngine::Precision prec);
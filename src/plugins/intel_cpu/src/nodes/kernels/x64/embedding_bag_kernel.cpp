@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl::cpu;
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jEmbeddingBagCallArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniEmbeddingBagKernel<isa>::jitUniEmbeddingBagKernel(const jEmbeddingBagConfParams& jcp) :
+        jitEmbeddingBagKernelBase(jcp), x64::jit_generator(jit_name()) {}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::create_ker() {
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create EmbeddingBag kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+uint32_t jitUniEmbeddingBagKernel<isa>::tableTypeShift() const {
+    switch (jcp.tablePrc) {
+        case Precision::FP32: return 2;
+        case Precision::BF16: return 1;
+        default: return 0;
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regTable, ptr[regParams + GET_OFF(table)]);
+    mov(regIndices, ptr[regParams + GET_OFF(indices)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regIndicesNum, ptr[regParams + GET_OFF(indicesNum)]);
+    mov(regRowSize, ptr[regParams + GET_OFF(rowSize)]);
+    mov(regRowStrideB, ptr[regParams + GET_OFF(rowStrideB)]);
+    if (jcp.withWeights)
+        mov(regWeights, ptr[regParams + GET_OFF(weights)]);
+    if (jcp.withScales)
+        mov(regScales, ptr[regParams + GET_OFF(scales)]);
+    if (jcp.withZeroPoints)
+        mov(regZeroPoints, ptr[regParams + GET_OFF(zeroPoints)]);
+
+    // the elements of the table row loaded into a vector register
+    const uint32_t elPerVec = vlen / sizeof(float);
+
+    Xbyak::Label lIdxLoop, lIdxEnd;
+    xor_(regIdxIter, regIdxIter);
+    L(lIdxLoop);
+    {
+        cmp(regIdxIter, regIndicesNum);
+        jge(lIdxEnd, T_NEAR);
+
+        initRow();
+
+        Xbyak::Label lVecLoop, lTailLoop, lRowEnd;
+        xor_(regElIter, regElIter);
+        L(lVecLoop);
+        {
+            mov(regAux, regRowSize);
+            sub(regAux, regElIter);
+            cmp(regAux, elPerVec);
+            jl(lTailLoop, T_NEAR);
+
+            accumulate(false);
+
+            add(regElIter, elPerVec);
+            jmp(lVecLoop, T_NEAR);
+        }
+        L(lTailLoop);
+        {
+            cmp(regElIter, regRowSize);
+            jge(lRowEnd, T_NEAR);
+
+            accumulate(true);
+
+            inc(regElIter);
+            jmp(lTailLoop, T_NEAR);
+        }
+        L(lRowEnd);
+
+        inc(regIdxIter);
+        jmp(lIdxLoop, T_NEAR);
+    }
+    L(lIdxEnd);
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::initRow() {
+    movsxd(regRowIdx, dword[regIndices + regIdxIter * sizeof(int)]);
+    mov(regRow, regRowIdx);
+    imul(regRow, regRowStrideB);
+    add(regRow, regTable);
+
+    // the row of the index prefetchDistance ahead, the current one at the end of the bag
+    Xbyak::Label lPrefetchRowEnd;
+    mov(regPrefetchRow, regRow);
+    lea(regAux, ptr[regIdxIter + prefetchDistance]);
+    cmp(regAux, regIndicesNum);
+    jge(lPrefetchRowEnd, T_NEAR);
+    movsxd(regPrefetchRow, dword[regIndices + regAux * sizeof(int)]);
+    imul(regPrefetchRow, regRowStrideB);
+    add(regPrefetchRow, regTable);
+    L(lPrefetchRowEnd);
+
+    // the coefficient of the row: the per sample weight multiplied by the decompression scale
+    // the bags of the default index and the empty bags come without the weights
+    Xbyak::Label lNoWeights, lCoefEnd;
+    if (jcp.withWeights) {
+        test(regWeights, regWeights);
+        jz(lNoWeights, T_NEAR);
+        if (jcp.weightsPrc == Precision::BF16) {
+            movzx(reg32Aux, word[regWeights + regIdxIter * sizeof(uint16_t)]);
+            shl(reg32Aux, 16);
+            vmovd(xmmCoef, reg32Aux);
+        } else {
+            vmovss(xmmCoef, dword[regWeights + regIdxIter * sizeof(float)]);
+        }
+        jmp(lCoefEnd, T_NEAR);
+    }
+    L(lNoWeights);
+    mov(reg32Aux, 0x3f800000);  // 1.f
+    vmovd(xmmCoef, reg32Aux);
+    L(lCoefEnd);
+    if (jcp.withScales)
+        vmulss(xmmCoef, xmmCoef, dword[regScales + regRowIdx * sizeof(float)]);
+    vbroadcastss(vmmCoef, xmmCoef);
+    if (jcp.withZeroPoints)
+        vbroadcastss(vmmZeroPoint, dword[regZeroPoints + regRowIdx * sizeof(float)]);
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::accumulate(bool isTail) {
+    const int tableTypeSize = 1 << tableTypeShift();
+    const Xbyak::Xmm& vSrc = isTail ? xmmSrc : vmmSrc;
+    loadRow(vSrc, regRow + regElIter * tableTypeSize, isTail);
+    if (!isTail)
+        prefetcht0(ptr[regPrefetchRow + regElIter * tableTypeSize]);
+    if (jcp.withZeroPoints) {
+        if (isTail)
+            vsubss(xmmSrc, xmmSrc, xmmZeroPoint);
+        else
+            vsubps(vmmSrc, vmmSrc, vmmZeroPoint);
+    }
+
+    const auto dstAddr = ptr[regDst + regElIter * sizeof(float)];
+    if (isTail) {
+        vmovss(xmmDst, dstAddr);
+        vfmadd231ss(xmmDst, xmmSrc, xmmCoef);
+        vmovss(dstAddr, xmmDst);
+    } else {
+        vmovups(vmmDst, dstAddr);
+        vfmadd231ps(vmmDst, vmmSrc, vmmCoef);
+        vmovups(dstAddr, vmmDst);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::loadRow(const Xbyak::Xmm& vDst, const Xbyak::RegExp& src, bool isTail) {
+    switch (jcp.tablePrc) {
+        case Precision::FP32:
+            if (isTail)
+                vmovss(vDst, dword[src]);
+            else
+                vmovups(vDst, ptr[src]);
+            break;
+        case Precision::BF16:
+            if (isTail) {
+                movzx(reg32Aux, word[src]);
+                shl(reg32Aux, 16);
+                vmovd(vDst, reg32Aux);
+            } else {
+                vpmovzxwd(vDst, ptr[src]);
+                vpslld(vDst, vDst, 16);
+            }
+            break;
+        case Precision::U8:
+        case Precision::I8: {
+            const bool isSigned = jcp.tablePrc == Precision::I8;
+            if (isTail) {
+                if (isSigned)
+                    movsx(reg32Aux, byte[src]);
+                else
+                    movzx(reg32Aux, byte[src]);
+                vcvtsi2ss(vDst, vDst, reg32Aux);
+            } else {
+                if (isSigned)
+                    vpmovsxbd(vDst, ptr[src]);
+                else
+                    vpmovzxbd(vDst, ptr[src]);
+                vcvtdq2ps(vDst, vDst);
+            }
+            break;
+        }
+        default:
+            IE_THROW() << "EmbeddingBag kernel doesn't support the table precision " << jcp.tablePrc.name();
+    }
+}
+
+template struct jitUniEmbeddingBagKernel<x64::avx2>;
+template struct jitUniEmbeddingBagKernel<x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// The kernel accumulates the rows of the embedding table selected by the indices of a bag into the FP32 row:
+//     dst[j] += weight[i] * scale[idx[i]] * (table[idx[i]][j] - zeroPoint[idx[i]])
+// The per sample weights, the row-wise decompression scales and zero points are optional.
+// The table rows are FP32, BF16, U8 or I8, the rows of the upcoming indices are prefetched while the current one
+// is accumulated, since the random rows of the large tables miss the caches.
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <ie_precision.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jEmbeddingBagConfParams {
+    InferenceEngine::Precision tablePrc = InferenceEngine::Precision::FP32;
+    InferenceEngine::Precision weightsPrc = InferenceEngine::Precision::FP32;
+    bool withWeights = false;
+    bool withScales = false;
+    bool withZeroPoints = false;
+};
+
+struct jEmbeddingBagCallArgs {
+    const void* table;
+    const int* indices;
+    // per sample weights of the indices
+    const void* weights;
+    // per row decompression parameters of the table
+    const float* scales;
+    const float* zeroPoints;
+    float* dst;
+    uint64_t indicesNum;
+    uint64_t rowSize;
+    uint64_t rowStrideB;
+};
+
+struct jitEmbeddingBagKernelBase {
+    void (*ker_)(const jEmbeddingBagCallArgs *);
+    void operator()(const jEmbeddingBagCallArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit jitEmbeddingBagKernelBase(const jEmbeddingBagConfParams& jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jitEmbeddingBagKernelBase() {}
+
+    virtual void create_ker() = 0;
+
+protected:
+    jEmbeddingBagConfParams jcp;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniEmbeddingBagKernel : public jitEmbeddingBagKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniEmbeddingBagKernel)
+
+    explicit jitUniEmbeddingBagKernel(const jEmbeddingBagConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static const uint32_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    // the number of the indices ahead whose rows are prefetched
+    static const uint32_t prefetchDistance = 8;
+
+    const Xbyak::Reg64 regParams = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    const Xbyak::Reg64& regTable = r8;
+    const Xbyak::Reg64& regIndices = r9;
+    const Xbyak::Reg64& regWeights = r10;
+    const Xbyak::Reg64& regScales = r11;
+    const Xbyak::Reg64& regZeroPoints = r12;
+    const Xbyak::Reg64& regDst = r13;
+    const Xbyak::Reg64& regIndicesNum = r14;
+    const Xbyak::Reg64& regRowSize = r15;
+    const Xbyak::Reg64& regRowStrideB = rbx;
+    const Xbyak::Reg64& regIdxIter = rbp;
+    const Xbyak::Reg64& regRowIdx = rax;
+    const Xbyak::Reg64& regRow = rdx;
+    const Xbyak::Reg64& regElIter = rsi;
+    const Xbyak::Reg64& regPrefetchRow = dnnl::impl::cpu::x64::abi_not_param1;
+    // the params are not needed after the arguments are loaded
+    const Xbyak::Reg64& regAux = regParams;
+    Xbyak::Reg32 reg32Aux = Xbyak::Reg32(regParams.getIdx());
+
+    Vmm vmmCoef = Vmm(0);
+    Vmm vmmZeroPoint = Vmm(1);
+    Vmm vmmSrc = Vmm(2);
+    Vmm vmmDst = Vmm(3);
+    Xbyak::Xmm xmmCoef = Xbyak::Xmm(vmmCoef.getIdx());
+    Xbyak::Xmm xmmZeroPoint = Xbyak::Xmm(vmmZeroPoint.getIdx());
+    Xbyak::Xmm xmmSrc = Xbyak::Xmm(vmmSrc.getIdx());
+    Xbyak::Xmm xmmDst = Xbyak::Xmm(vmmDst.getIdx());
+
+    void initRow();
+    void accumulate(bool isTail);
+    // loads the elements of the table row converting them to FP32, a single element for the tail
+    void loadRow(const Xbyak::Xmm& vDst, const Xbyak::RegExp& src, bool isTail);
+    uint32_t tableTypeShift() const;
+};
+
+} // namespace intel_cpu
+} // namespace ov
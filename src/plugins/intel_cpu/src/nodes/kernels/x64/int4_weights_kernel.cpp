@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "int4_weights_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jInt4WeightsCallArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniInt4WeightsKernel<isa>::jitUniInt4WeightsKernel(const jInt4WeightsConfParams& jcp) :
+        jitInt4WeightsKernelBase(jcp, elPerVec), x64::jit_generator(jit_name()) {}
+
+template <x64::cpu_isa_t isa>
+void jitUniInt4WeightsKernel<isa>::create_ker() {
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create Int4Weights kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniInt4WeightsKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regWeights, ptr[regParams + GET_OFF(weights)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regCount, ptr[regParams + GET_OFF(count)]);
+    vbroadcastss(vmmScale, dword[regParams + GET_OFF(scale)]);
+    if (jcp.withZeroPoint)
+        vbroadcastss(vmmZeroPoint, dword[regParams + GET_OFF(zeroPoint)]);
+
+    mov(reg32Aux, 0x0F0F0F0F);
+    vmovd(xmmMask, reg32Aux);
+    vpbroadcastd(xmmMask, xmmMask);
+    if (jcp.isSigned) {
+        mov(reg32Aux, 8);
+        vmovd(xmmEight, reg32Aux);
+        vpbroadcastd(vmmEight, xmmEight);
+    }
+
+    Xbyak::Label lLoop, lEnd;
+    L(lLoop);
+    {
+        cmp(regCount, elPerVec);
+        jl(lEnd, T_NEAR);
+
+        loadWeights();
+        if (jcp.withZeroPoint)
+            vsubps(vmmValues, vmmValues, vmmZeroPoint);
+        vmulps(vmmValues, vmmValues, vmmScale);
+        vmovups(ptr[regDst], vmmValues);
+
+        add(regWeights, elPerVec / 2);
+        add(regDst, vlen);
+        sub(regCount, elPerVec);
+        jmp(lLoop, T_NEAR);
+    }
+    L(lEnd);
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniInt4WeightsKernel<isa>::loadWeights() {
+    // two weights per byte: 4 bytes for the 8 values of Ymm, 8 bytes for the 16 values of Zmm
+    if (isa == x64::avx2)
+        vmovd(xmmHigh, dword[regWeights]);
+    else
+        vmovq(xmmHigh, qword[regWeights]);
+    vpand(xmmLow, xmmHigh, xmmMask);
+    vpsrlw(xmmHigh, xmmHigh, 4);
+    vpand(xmmHigh, xmmHigh, xmmMask);
+    // the first weight of a byte is stored in the high nibble
+    vpunpcklbw(xmmHigh, xmmHigh, xmmLow);
+    vpmovzxbd(vmmValues, xmmHigh);
+    if (jcp.isSigned) {
+        // sign extension of the nibble: (v ^ 8) - 8
+        if (isa == x64::avx2)
+            vpxor(vmmValues, vmmValues, vmmEight);
+        else
+            vpxord(vmmValues, vmmValues, vmmEight);
+        vpsubd(vmmValues, vmmValues, vmmEight);
+    }
+    vcvtdq2ps(vmmValues, vmmValues);
+}
+
+template struct jitUniInt4WeightsKernel<x64::avx2>;
+template struct jitUniInt4WeightsKernel<x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
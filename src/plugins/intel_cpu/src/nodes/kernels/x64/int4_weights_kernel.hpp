@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// The kernel decompresses a segment of a row of the 4-bit weights into FP32:
+//     dst[i] = (weights[i] - zeroPoint) * scale
+// The weights are stored two per byte, the first one in the high nibble. The segment starts at a byte boundary and
+// its length is a multiple of the step, the rest of the row is decompressed by the caller.
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct jInt4WeightsConfParams {
+    bool isSigned = false;
+    bool withZeroPoint = false;
+};
+
+struct jInt4WeightsCallArgs {
+    const uint8_t* weights;
+    float* dst;
+    float scale;
+    float zeroPoint;
+    uint64_t count;
+};
+
+struct jitInt4WeightsKernelBase {
+    void (*ker_)(const jInt4WeightsCallArgs *);
+    void operator()(const jInt4WeightsCallArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    jitInt4WeightsKernelBase(const jInt4WeightsConfParams& jcp, size_t step) : ker_(nullptr), step(step), jcp(jcp) {}
+    virtual ~jitInt4WeightsKernelBase() {}
+
+    virtual void create_ker() = 0;
+
+    // the number of the weights decompressed per iteration, the count must be a multiple of it
+    const size_t step;
+
+protected:
+    jInt4WeightsConfParams jcp;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniInt4WeightsKernel : public jitInt4WeightsKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniInt4WeightsKernel)
+
+    explicit jitUniInt4WeightsKernel(const jInt4WeightsConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static const uint32_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    static const uint32_t elPerVec = vlen / sizeof(float);
+
+    const Xbyak::Reg64 regParams = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    const Xbyak::Reg64& regWeights = r8;
+    const Xbyak::Reg64& regDst = r9;
+    const Xbyak::Reg64& regCount = r10;
+    const Xbyak::Reg32& reg32Aux = eax;
+
+    Vmm vmmScale = Vmm(0);
+    Vmm vmmZeroPoint = Vmm(1);
+    Vmm vmmEight = Vmm(2);
+    Vmm vmmValues = Vmm(3);
+    Xbyak::Xmm xmmMask = Xbyak::Xmm(4);
+    Xbyak::Xmm xmmHigh = Xbyak::Xmm(5);
+    Xbyak::Xmm xmmLow = Xbyak::Xmm(6);
+    Xbyak::Xmm xmmEight = Xbyak::Xmm(vmmEight.getIdx());
+
+    // loads the bytes of elPerVec weights and converts them to FP32
+    void loadWeights();
+};
+
+} // namespace intel_cpu
+} // namespace ov
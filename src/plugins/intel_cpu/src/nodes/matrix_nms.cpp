@@ -14,6 +14,7 @@
 #include "ie_parallel.hpp"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_kernels.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
@@ -91,15 +92,6 @@ MatrixNms::MatrixNms(const std::shared_ptr<ngraph::Node>& op, const GraphContext
     m_gaussianSigma = attrs.gaussian_sigma;
     m_postThreshold = attrs.post_threshold;
     m_normalized = attrs.normalized;
-    if (m_decayFunction == MatrixNmsDecayFunction::LINEAR) {
-        m_decay_fn = [](float iou, float max_iou, float sigma) -> float {
-            return (1. - iou) / (1. - max_iou + 1e-10f);
-        };
-    } else {
-        m_decay_fn = [](float iou, float max_iou, float sigma) -> float {
-            return std::exp((max_iou * max_iou - iou * iou) * sigma);
-        };
-    }
 
     const auto& boxes_dims = getInputShapeAtPort(NMS_BOXES).getDims();
     if (boxes_dims.size() != 3)
@@ -153,23 +145,6 @@ static inline float boxArea(const float* bbox, const bool normalized) {
     }
 }
 
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
@@ -187,25 +162,41 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
         originalSize = m_nmsTopk;
     }
 
-    std::partial_sort(candidateIndex.begin(), candidateIndex.begin() + originalSize, end, [&scoresData](int32_t a, int32_t b) {
+    nmsSortTopK(candidateIndex.begin(), end, originalSize, [&scoresData](int32_t a, int32_t b) {
         return scoresData[a] > scoresData[b];
     });
 
-    std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
-    std::vector<float> iouMax(originalSize);
+    // the IoU matrix isn't stored: the IoU of the box with the higher scored ones are computed by the vectorized
+    // kernel twice, for their max and for the decay, which keeps the memory linear and both passes parallel
+    NmsBoxes candidates(m_normalized ? 0.f : 1.f, true);
+    candidates.reserve(originalSize);
+    std::vector<float> candidateAreas(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        candidateAreas[i] = boxArea(box, m_normalized);
+        candidates.add(box, candidateAreas[i]);
+    }
 
+    std::vector<float> iouMax(originalSize);
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
-        size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (size_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
+        const size_t actualIndex = i + 1;
+        iouMax[actualIndex] = candidates.maxIou(boxesData + candidateIndex[actualIndex] * 4, candidateAreas[actualIndex], actualIndex);
+    });
+
+    std::vector<float> decayedScores(originalSize);
+    decayedScores[0] = scoresData[candidateIndex[0]];
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t workStart = 0, workEnd = 0;
+        splitter(originalSize - 1, nthr, ithr, workStart, workEnd);
+        std::vector<float> iouRow(workEnd > workStart ? workEnd : 0);
+        for (size_t i = workStart + 1; i < workEnd + 1; i++) {
+            candidates.iou(boxesData + candidateIndex[i] * 4, candidateAreas[i], 0, i, iouRow.data());
+            const float minDecay = m_decayFunction == MatrixNmsDecayFunction::LINEAR ?
+                                   nmsMinDecayLinear(iouRow.data(), iouMax.data(), i) :
+                                   nmsMinDecayGaussian(iouRow.data(), iouMax.data(), i, m_gaussianSigma);
+            decayedScores[i] = minDecay * scoresData[candidateIndex[i]];
         }
-        iouMax[actual_index] = max_iou;
     });
 
     if (scoresData[candidateIndex[0]] > m_postThreshold) {
@@ -223,14 +214,7 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
     }
 
     for (int64_t i = 1; i < originalSize; i++) {
-        float minDecay = 1.;
-        for (int64_t j = 0; j < i; j++) {
-            auto maxIou = iouMax[j];
-            auto iou = iouMatrix[i * (i - 1) / 2 + j];
-            auto decay = m_decay_fn(iou, maxIou, m_gaussianSigma);
-            minDecay = std::min(minDecay, decay);
-        }
-        auto ds = minDecay * scoresData[candidateIndex[i]];
+        auto ds = decayedScores[i];
         if (ds <= m_postThreshold)
             continue;
         auto boxIndex = candidateIndex[i];
@@ -78,6 +78,45 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::createPrimitive() {
+    auto parentEdge = getParentEdgeAt(0);
+    defaultPtr = parentEdge->getMemory().getData();
+
+    // The same conditions as for the output blobs of the infer request: the memory must be written by its producers
+    // only, so it may be replaced. The memory of the graph inputs is managed by the infer request.
+    writesStateInPlace = true;
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+            one_of(parent->getType(), Type::Input, Type::MemoryInput)) {
+            writesStateInPlace = false;
+            break;
+        }
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().getData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+}
+
+void MemoryOutput::assignState(const MemoryPtr& store) {
+    if (!writesStateInPlace)
+        return;
+    auto& mem = getParentEdgeAt(0)->getMemory();
+    auto ptr = store && store->getDesc().isCompatible(mem.getDesc()) ? store->getData() : defaultPtr;
+    if (mem.getData() != ptr)
+        mem.getMemoryMngr()->setExtBuff(ptr, mem.getSize());
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -124,6 +163,35 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->nullify();
+
+    // The same conditions as for the input blobs of the infer request: the consumers must neither expect the data
+    // at a specific location nor modify it, so the memory may be replaced by the state memory.
+    defaultPtr = getChildEdgeAt(0)->getMemory().getData();
+    readsStateInPlace = true;
+    for (auto& childEdge : getChildEdges()) {
+        auto edge = childEdge.lock();
+        if (!edge)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& child = edge->getChild();
+        if (child->isConstant() || edge->inPlace(Edge::LOOK_DOWN) || edge->modifiedInPlace() ||
+            (child->getType() == Type::Concatenation && child->isInPlace())) {
+            readsStateInPlace = false;
+            break;
+        }
+    }
+}
+
+void MemoryInput::redirectChildEdges(void* ptr) {
+    for (auto& childEdge : getChildEdges()) {
+        auto edge = childEdge.lock();
+        if (!edge)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& mem = edge->getMemory();
+        if (mem.getData() != ptr)
+            mem.getMemoryMngr()->setExtBuff(ptr, mem.getSize());
+    }
 }
 
 /**
@@ -158,17 +226,70 @@ MemoryPtr MemoryInput::getStore() {
 }
 
 void MemoryInput::storeState(const IMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.load(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    if (stateSlots) {
+        stateSlots->scatter(getId(), rowSlots, new_state);
+        return;
+    }
+    if (nextStore) {
+        // the new state is already in the next state memory, unless the producer couldn't write it there
+        if (new_state.getData() != nextStore->getData())
+            simple_copy(*nextStore, new_state);
+        stateStored = true;
+    } else {
+        // TODO: Should be next one call:
+        //           dataStore.load(new_state, false);
+        //       But because of performance reason we use simple manual copy
+        simple_copy(*dataStore, new_state);
+    }
+    resetPending = false;
+}
+
+void MemoryInput::assignState(MemoryPtr store, MemoryPtr nextStore, bool reset) {
+    const auto size = getChildEdgeAt(0)->getMemory().getSize();
+    IE_ASSERT(store && nextStore && store->getSize() == size && nextStore->getSize() == size)
+        << "MemoryInput " << getName() << " got incompatible state memory";
+    dataStore = std::move(store);
+    this->nextStore = std::move(nextStore);
+    resetPending = reset;
+    stateStored = false;
+    stateSlots.reset();
+
+    if (readsStateInPlace)
+        redirectChildEdges(dataStore->getData());
+    if (outputNode)
+        outputNode->assignState(this->nextStore);
+}
+
+void MemoryInput::assignSlots(StateSlots::Ptr slots, const std::vector<int>& slotsOfRows) {
+    stateSlots = std::move(slots);
+    rowSlots = slotsOfRows;
+
+    // the rows are gathered into and scattered from the memory of the graph, not the state memory of a request
+    nextStore.reset();
+    stateStored = false;
+    if (readsStateInPlace)
+        redirectChildEdges(defaultPtr);
+    if (outputNode)
+        outputNode->assignState(nullptr);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    if (stateSlots) {
+        stateSlots->gather(getId(), rowSlots, getChildEdgeAt(0)->getMemory());
+        return;
+    }
+    if (resetPending) {
+        getChildEdgeAt(0)->getMemoryPtr()->nullify();
+        return;
+    }
+    // the consumers read the state memory in place, unless the memory of the edges couldn't be replaced
+    auto& dst = getChildEdgeAt(0)->getMemory();
+    if (dst.getData() == dataStore->getData())
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.load(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dst, *dataStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -180,6 +301,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput
         auto outputNode = dynamic_cast<MemoryOutput*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -195,6 +317,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerOutput(MemoryOutpu
         auto inputNode = dynamic_cast<MemoryInput*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
@@ -8,6 +8,7 @@
 #include <cpu_types.h>
 #include "ie_algorithm.hpp"
 #include "input.h"
+#include "memory_state.h"
 #include <node.h>
 #include <string>
 #include <memory>
@@ -66,7 +67,7 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override {
         return getType() == Type::MemoryOutput;
@@ -76,12 +77,21 @@ public:
         inputNode = node;
     }
 
+    /**
+     * @brief Makes the producer of the new state write it into the state memory directly, if possible
+     * @param store memory of the new state, nullptr restores the memory allocated by the graph
+     */
+    void assignState(const MemoryPtr& store);
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    // the input memory may be replaced by the state memory, otherwise the new state is copied
+    bool writesStateInPlace = false;
+    void* defaultPtr = nullptr;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -101,10 +111,52 @@ public:
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
     void storeState(const IMemory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief Makes the graph read and write the state memory owned by the infer request instead of the internal store.
+     * The consumers of the node read the current state in place and the producer of the new state writes it into
+     * the next state memory, when the memory of the graph edges may be replaced, otherwise the state is copied.
+     * @param store current state memory, it must be compatible with the internal store
+     * @param nextStore memory the new state is stored into, the infer request swaps the memories after the inference
+     * @param reset if true, the node produces zeros regardless of the store content until a new state is stored
+     */
+    void assignState(MemoryPtr store, MemoryPtr nextStore, bool reset);
+
+    /**
+     * @brief Makes the node gather the rows of the state from the state slots and scatter the new rows into them
+     * @param slots state slots of the compiled model
+     * @param slotsOfRows slot of each row of the batch, -1 for the rows bound to no slot
+     */
+    void assignSlots(StateSlots::Ptr slots, const std::vector<int>& slotsOfRows);
+    bool isResetPending() const {
+        return resetPending;
+    }
+
+    /**
+     * @brief Returns true if the new state was stored into the next state memory during the last inference
+     */
+    bool isStateStored() const {
+        return stateStored;
+    }
+
  private:
+    void redirectChildEdges(void* ptr);
+
     MemoryPtr dataStore;
+    MemoryPtr nextStore;
+    bool resetPending = false;
+    bool stateStored = false;
+    MemoryOutput* outputNode = nullptr;
+    // the output memory may be replaced by the state memory, otherwise the state is copied
+    bool readsStateInPlace = false;
+    void* defaultPtr = nullptr;
+    StateSlots::Ptr stateSlots;  // null if the state is not batched over the slots
+    std::vector<int> rowSlots;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
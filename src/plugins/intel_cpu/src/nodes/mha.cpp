@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -1224,7 +1225,14 @@ void MHA::mhaImpl() {
 
     auto outPrcSize = outputPrecision.size();
 
+    // each (batch, head) chunk is a pair of big matmuls, an interrupted inference skips the rest of the chunks
+    const auto& checkpoint = *context->getInferCheckpoint();
+    std::atomic<bool> interrupted{false};
     parallel_for2d(dimsMatMul0Out[0], dimsMatMul0Out[1], [&](size_t i0, size_t i1) {
+        if (checkpoint.isInterrupted()) {
+            interrupted.store(true, std::memory_order_relaxed);
+            return;
+        }
         size_t threadNum = parallel_get_thread_num();
 
         auto pTranspose0In0_aux = pTranspose0In0 + (i0 * strTranspose0In0[0] + i1 * strTranspose0In0[2]) * inputPrecisions[0].size(); // order 0213
@@ -1418,6 +1426,9 @@ void MHA::mhaImpl() {
             }
         }
     });
+    // the completed chunks don't fail the inference, even if it was interrupted after the last of them
+    if (interrupted)
+        checkpoint.check();
 }
 
 void MHA::execute(dnnl::stream strm) {
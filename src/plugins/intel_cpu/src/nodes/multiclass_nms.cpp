@@ -17,6 +17,7 @@
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_kernels.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
@@ -558,30 +559,27 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                const size_t max_out_box = std::min(static_cast<size_t>(m_nmsRealTopk), sorted_boxes.size());
+                // only the top candidates may be selected
+                nmsSortTopK(sorted_boxes.begin(), sorted_boxes.end(), max_out_box, [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
+                const float norm = static_cast<float>(m_normalized == false);
+                NmsBoxes selected(norm);
+                selected.reserve(max_out_box);
+                auto suppressed = [this](float iou) {
+                    return iou >= m_iouThreshold;
+                };
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                for (size_t box_idx = 0; box_idx < max_out_box; box_idx++) {
+                    const float* box = &boxesPtr[sorted_boxes[box_idx].second * 4];
+                    const float area = NmsBoxes::area(box, norm);
+                    if (selected.any(box, area, selected.size(), suppressed))
+                        continue;
+                    selected.add(box, area);
+                    m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
+                        sorted_boxes[box_idx].second);
+                    io_selection_size++;
                 }
             }
             m_numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -9,10 +9,12 @@
 #include <dnnl_extension_utils.h>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <cmath>
 #include "common/cpu_memcpy.h"
 
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <openvino/op/scatter_elements_update.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -26,7 +28,8 @@ bool ScatterUpdate::isSupportedOperation(const std::shared_ptr<const ngraph::Nod
         auto scatterElemUpd = ngraph::as_type_ptr<const ngraph::opset3::ScatterElementsUpdate>(op);
         auto scatterUpd = ngraph::as_type_ptr<const ngraph::opset3::ScatterUpdate>(op);
         auto scatterNdUpd = ngraph::as_type_ptr<const ngraph::opset4::ScatterNDUpdate>(op);
-        if (!scatterElemUpd && !scatterUpd && !scatterNdUpd) {
+        auto scatterElemUpd12 = ov::as_type_ptr<const ov::op::v12::ScatterElementsUpdate>(op);
+        if (!scatterElemUpd && !scatterUpd && !scatterNdUpd && !scatterElemUpd12) {
             const std::string opType = op->get_type_name();
             errorMessage = "Only opset" + opType == "ScatterNDUpdate" ? "4 " : "3 " + opType + " operation is supported";
             return false;
@@ -50,6 +53,10 @@ ScatterUpdate::ScatterUpdate(const std::shared_ptr<ngraph::Node>& op, const Grap
     std::string errorMessage;
     if (isSupportedOperation(op, errorMessage)) {
         errorPrefix = std::string(op->get_type_name()) + " node with name '" + getName() + "'";
+        if (const auto scatterElemUpd12 = ov::as_type_ptr<const ov::op::v12::ScatterElementsUpdate>(op)) {
+            reduction = scatterElemUpd12->get_reduction();
+            useInitVal = scatterElemUpd12->get_use_init_val();
+        }
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
@@ -186,6 +193,8 @@ void ScatterUpdate::initSupportedPrimitiveDescriptors() {
     }
 
     dataPrec = getOriginalInputPrecisionAtPort(DATA_ID);
+    if (reduction != Reduction::NONE && !one_of(dataPrec, Precision::FP32, Precision::I32, Precision::I8, Precision::U8))
+        dataPrec = dataPrec.is_float() ? Precision::FP32 : Precision::I32;
     dataSize = dataPrec.size();
 
     bool canBeInplace = !isDynamicNode() && getParentEdgeAt(DATA_ID)->getParent()->getChildEdges().size() == 1 &&
@@ -355,7 +364,21 @@ void ScatterUpdate::execute(dnnl::stream strm) {
             break;
         }
         case ScatterUpdateMode::ScatterElementsUpdate: {
-            scatterElementsUpdate(indicesPtr, updatePtr, axis, dstPtr);
+            ScatterElementsUpdateContext ctx{this, indicesPtr, updatePtr, axis, dstPtr};
+            if (reduction == Reduction::NONE) {
+                // the elements are only copied, so the type of the same size fits any precision
+                OV_SWITCH(intel_cpu, ScatterElementsUpdateDispatcher, ctx, dataSize,
+                          OV_CASE(sizeof(uint8_t), uint8_t),
+                          OV_CASE(sizeof(uint16_t), uint16_t),
+                          OV_CASE(sizeof(uint32_t), uint32_t),
+                          OV_CASE(sizeof(uint64_t), uint64_t));
+            } else {
+                OV_SWITCH(intel_cpu, ScatterElementsUpdateDispatcher, ctx, dataPrec,
+                          OV_CASE(Precision::FP32, float),
+                          OV_CASE(Precision::I32, int32_t),
+                          OV_CASE(Precision::I8, int8_t),
+                          OV_CASE(Precision::U8, uint8_t));
+            }
             break;
         }
         default: {
@@ -432,54 +455,317 @@ void ScatterUpdate::scatterNDUpdate(uint8_t *indices, uint8_t *update, uint8_t *
     });
 }
 
+namespace {
+struct ReduceNone {
+    template <typename T>
+    static void apply(T& dst, const T src) { dst = src; }
+};
+struct ReduceSum {
+    template <typename T>
+    static void apply(T& dst, const T src) { dst = static_cast<T>(dst + src); }
+};
+struct ReduceProd {
+    template <typename T>
+    static void apply(T& dst, const T src) { dst = static_cast<T>(dst * src); }
+};
+struct ReduceMin {
+    template <typename T>
+    static void apply(T& dst, const T src) { dst = std::min(dst, src); }
+};
+struct ReduceMax {
+    template <typename T>
+    static void apply(T& dst, const T src) { dst = std::max(dst, src); }
+};
+// the sums are divided by the counts of the reduced elements when all the updates are applied
+struct ReduceMean : ReduceSum {};
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type arithmeticMean(const T sum, const int32_t count) {
+    return sum / count;
+}
+
+// the integer means are rounded down as PyTorch does
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type arithmeticMean(const T sum, const int32_t count) {
+    return static_cast<T>(std::floor(static_cast<double>(sum) / count));
+}
+}   // namespace
+
+template <typename DataType, typename IndexType>
+void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
+    switch (reduction) {
+        case Reduction::NONE:
+            scatterElementsUpdate<DataType, IndexType, ReduceNone>(indices, update, axis, dstData);
+            break;
+        case Reduction::SUM:
+            scatterElementsUpdate<DataType, IndexType, ReduceSum>(indices, update, axis, dstData);
+            break;
+        case Reduction::PROD:
+            scatterElementsUpdate<DataType, IndexType, ReduceProd>(indices, update, axis, dstData);
+            break;
+        case Reduction::MIN:
+            scatterElementsUpdate<DataType, IndexType, ReduceMin>(indices, update, axis, dstData);
+            break;
+        case Reduction::MAX:
+            scatterElementsUpdate<DataType, IndexType, ReduceMax>(indices, update, axis, dstData);
+            break;
+        case Reduction::MEAN:
+            scatterElementsUpdate<DataType, IndexType, ReduceMean>(indices, update, axis, dstData);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported reduction";
+    }
+}
+
+// The update rows (all the elements along the inner dimensions at a position outside the axis) are reduced as a whole
+// when each of them is scattered to a single output row. The output rows are split into the ranges and the update rows
+// are bucketed by these ranges with a stable parallel counting sort, so the updates of an output row keep their order.
+// The counters of the mean and of use_init_val=false are kept per output row (and per block of the inner elements).
+// Returns false without touching the output if some update row is scattered to several output rows.
+template <typename DataType, typename IndexType, typename Reduce, typename OuterOffset>
+bool ScatterUpdate::scatterElementsUpdateRows(const IndexType *idxData, const DataType *updData, DataType *dst,
+                                              const size_t updRows, const size_t axisSize, const size_t innerSize,
+                                              const size_t dstRows, const OuterOffset& getOuterOffset,
+                                              const int64_t dstAxisSize, const bool withCounters) {
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t chunks = std::min(nthr, updRows);
+    // a few ranges per thread smooth out the skewed degrees of the graph nodes
+    const size_t parts = std::min(4 * nthr, dstRows);
+    const size_t rowsPerPart = div_up(dstRows, parts);
+
+    // the output row of each update row and the histogram of the ranges per chunk of the update rows
+    updRowTargets.resize(updRows);
+    rowBucketOffsets.assign(chunks * parts, 0);
+    std::vector<char> uniform(chunks, true);
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0, end = 0;
+        splitter(updRows, chunks, chunk, start, end);
+        size_t *counts = rowBucketOffsets.data() + chunk * parts;
+        for (size_t r = start; r < end; r++) {
+            const IndexType *idxRow = idxData + r * innerSize;
+            for (size_t c = 1; c < innerSize; c++) {
+                if (idxRow[c] != idxRow[0]) {
+                    uniform[chunk] = false;
+                    return;
+                }
+            }
+            int64_t idxValue = static_cast<int64_t>(idxRow[0]);
+            if (idxValue < 0)
+                idxValue += dstAxisSize;
+            if (idxValue < 0 || idxValue >= dstAxisSize) {
+                updRowTargets[r] = -1;
+                continue;
+            }
+            const size_t dstRow = getOuterOffset(r / axisSize) / innerSize + static_cast<size_t>(idxValue);
+            updRowTargets[r] = static_cast<int64_t>(dstRow);
+            counts[dstRow / rowsPerPart]++;
+        }
+    });
+    if (std::find(uniform.begin(), uniform.end(), false) != uniform.end())
+        return false;
+
+    // the ranges are laid out one after another, the chunks of a range in the order of the update rows
+    rowBucketBegins.resize(parts + 1);
+    size_t total = 0;
+    for (size_t p = 0; p < parts; p++) {
+        rowBucketBegins[p] = total;
+        for (size_t chunk = 0; chunk < chunks; chunk++) {
+            const size_t count = rowBucketOffsets[chunk * parts + p];
+            rowBucketOffsets[chunk * parts + p] = total;
+            total += count;
+        }
+    }
+    rowBucketBegins[parts] = total;
+    rowBuckets.resize(total);
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0, end = 0;
+        splitter(updRows, chunks, chunk, start, end);
+        size_t *offsets = rowBucketOffsets.data() + chunk * parts;
+        for (size_t r = start; r < end; r++) {
+            if (updRowTargets[r] >= 0)
+                rowBuckets[offsets[static_cast<size_t>(updRowTargets[r]) / rowsPerPart]++] = r;
+        }
+    });
+
+    // the rows are split into the blocks of the inner elements only if there are too few ranges to feed the threads
+    const size_t innerBlocks = parts >= nthr ? 1 : std::min(div_up(nthr, parts), innerSize);
+    const size_t innerBlock = div_up(innerSize, innerBlocks);
+    if (withCounters && reductionCounters.size() < dstRows * innerBlocks)
+        reductionCounters.resize(dstRows * innerBlocks, 0);
+    int32_t *counters = reductionCounters.data();
+
+    parallel_for2d(parts, innerBlocks, [&](size_t p, size_t b) {
+        const size_t cBegin = b * innerBlock;
+        const size_t cEnd = std::min(cBegin + innerBlock, innerSize);
+        for (size_t i = rowBucketBegins[p]; i < rowBucketBegins[p + 1]; i++) {
+            const size_t r = rowBuckets[i];
+            const size_t dstRow = static_cast<size_t>(updRowTargets[r]);
+            const DataType *src = updData + r * innerSize;
+            DataType *dstRowData = dst + dstRow * innerSize;
+            if (withCounters && counters[dstRow * innerBlocks + b]++ == 0 && !useInitVal) {
+                std::copy(src + cBegin, src + cEnd, dstRowData + cBegin);
+                continue;
+            }
+            for (size_t c = cBegin; c < cEnd; c++)
+                Reduce::apply(dstRowData[c], src[c]);
+        }
+        if (!withCounters)
+            return;
+        for (size_t i = rowBucketBegins[p]; i < rowBucketBegins[p + 1]; i++) {
+            const size_t dstRow = static_cast<size_t>(updRowTargets[rowBuckets[i]]);
+            int32_t& count = counters[dstRow * innerBlocks + b];
+            if (count == 0)
+                continue;
+            if (std::is_same<Reduce, ReduceMean>::value) {
+                DataType *dstRowData = dst + dstRow * innerSize;
+                for (size_t c = cBegin; c < cEnd; c++)
+                    dstRowData[c] = arithmeticMean(dstRowData[c], count + static_cast<int32_t>(useInitVal));
+            }
+            count = 0;
+        }
+    });
+    return true;
+}
+
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
 // output[i][indices[i][j][k]][k] = updates[i][j][k] if axis = 1,
 // output[i][j][indices[i][j][k]] = updates[i][j][k] if axis = 2.
+// The updates of the different positions outside the axis never hit the same output element, so the work is split
+// by these positions (the outer ones before the axis and the blocks of the inner ones after it) and, when they are
+// too few to feed the threads, by the ranges of the output rows along the axis as well. Each output element is
+// reduced by a single thread in the order of the updates, so neither atomics nor private copies of the output are needed.
+template <typename DataType, typename IndexType, typename Reduce>
 void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
     const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
     const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
-    size_t updateRank = updateDim.size();
+    const size_t updateRank = updateDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
     std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        int j;
-        size_t i, dst_idx = 0, start = 0, end = 0;
-        SizeVector tensorItr(updateRank, 0);
-        splitter(updateBlockND[0], nthr, ithr, start, end);
-        for (j = updateRank - 1, i = start; j >= 0; j--) {
-            tensorItr[j] = i % updateDim[j];
-            i /= updateDim[j];
+    const auto *idxData = reinterpret_cast<const IndexType*>(indices);
+    const auto *updData = reinterpret_cast<const DataType*>(update);
+    auto *dst = reinterpret_cast<DataType*>(dstData);
+
+    const size_t outerSize = updateBlockND[0] / updateBlockND[axis];
+    const size_t axisSize = updateDim[axis];
+    const size_t innerSize = updateBlockND[axis + 1];
+    const int64_t dstAxisSize = static_cast<int64_t>(srcDataDim[axis]);
+    const size_t dstAxisStride = srcBlockND[axis + 1];
+
+    // the offset in the output of the update position outside the axis decomposed over the dimensions [begin, end)
+    auto getDstOffset = [&](size_t pos, const size_t begin, const size_t end) {
+        size_t offset = 0;
+        for (size_t j = end; j > begin; j--) {
+            offset += (pos % updateDim[j - 1]) * srcBlockND[j];
+            pos /= updateDim[j - 1];
         }
+        return offset;
+    };
+    bool innerDense = true;
+    for (size_t j = axis + 1; j < updateRank; j++)
+        innerDense = innerDense && updateDim[j] == srcDataDim[j];
+    std::vector<size_t> innerOffsets;
+    if (!innerDense) {
+        innerOffsets.resize(innerSize);
+        for (size_t c = 0; c < innerSize; c++)
+            innerOffsets[c] = getDstOffset(c, axis + 1, updateRank);
+    }
 
-        for (i = 0; i < static_cast<size_t>(axis); ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-        for (i++; i < updateRank; ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
+    // the counters of the updates reduced into the output elements for the mean and for the reductions
+    // ignoring the initial values, they are reset after the use to be zero at the next inference
+    const bool withCounters = std::is_same<Reduce, ReduceMean>::value ||
+                              (!useInitVal && !std::is_same<Reduce, ReduceNone>::value);
+
+    const size_t innerBlock = 64;
+    const size_t innerBlocks = div_up(innerSize, innerBlock);
+    const size_t columns = outerSize * innerBlocks;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t rowParts = columns >= nthr ? 1 : std::min(div_up(nthr, columns), static_cast<size_t>(dstAxisSize));
+    const int64_t rowsPerPart = static_cast<int64_t>(div_up(dstAxisSize, rowParts));
+
+    // Few positions outside the axis and the whole rows of the updates scattered to the same index, as the message
+    // passing of the graph networks does: the update rows are bucketed by the ranges of the output rows in one pass,
+    // so each thread visits only the rows of its own range instead of filtering all of them
+    if (rowParts > 1 && innerDense &&
+        scatterElementsUpdateRows<DataType, IndexType, Reduce>(idxData, updData, dst, outerSize * axisSize, axisSize, innerSize,
+                                                               srcBlockND[0] / innerSize,
+                                                               [&](size_t outer) { return getDstOffset(outer, 0, axis); },
+                                                               dstAxisSize, withCounters)) {
+        return;
+    }
 
-        for (size_t iwork = start; iwork < end; iwork++) {
-            int64_t idxValue = getIndicesValue(indices, iwork);
-            int64_t axisDim = static_cast<int64_t>(srcDataDim[axis]);
+    if (withCounters && reductionCounters.size() < srcBlockND[0])
+        reductionCounters.resize(srcBlockND[0], 0);
+    int32_t *counters = reductionCounters.data();
+
+    parallel_for(columns * rowParts, [&](size_t task) {
+        const size_t column = task / rowParts;
+        const int64_t rowBegin = static_cast<int64_t>(task % rowParts) * rowsPerPart;
+        const int64_t rowEnd = std::min(rowBegin + rowsPerPart, dstAxisSize);
+        const size_t outer = column / innerBlocks;
+        const size_t innerBegin = (column % innerBlocks) * innerBlock;
+        const size_t innerEnd = std::min(innerBegin + innerBlock, innerSize);
+        const size_t dstOuterOffset = getDstOffset(outer, 0, axis);
+
+        auto getDstIdx = [&](const size_t updIdx, const size_t c, size_t& dstIdx) {
+            int64_t idxValue = static_cast<int64_t>(idxData[updIdx]);
             if (idxValue < 0)
-                idxValue += axisDim;
-            if (0 <= idxValue && idxValue < axisDim)
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
-
-            for (j = updateRank - 1; j >= 0; j--) {
-                tensorItr[j]++;
-                if (tensorItr[j] < updateDim[j]) {
-                    if (j != axis)
-                        dst_idx += srcBlockND[j + 1];
-                    break;
-                } else {
-                    tensorItr[j] = 0;
-                    for (dst_idx = 0, i = 0; i < static_cast<size_t>(axis); ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
-                    for (i++; i < updateRank; ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
+                idxValue += dstAxisSize;
+            dstIdx = dstOuterOffset + idxValue * dstAxisStride + (innerDense ? c : innerOffsets[c]);
+            return rowBegin <= idxValue && idxValue < rowEnd;
+        };
+
+        if (withCounters) {
+            size_t dstIdx = 0;
+            for (size_t k = 0; k < axisSize; k++) {
+                const size_t updRow = (outer * axisSize + k) * innerSize;
+                for (size_t c = innerBegin; c < innerEnd; c++) {
+                    if (!getDstIdx(updRow + c, c, dstIdx))
+                        continue;
+                    if (counters[dstIdx]++ == 0 && !useInitVal)
+                        dst[dstIdx] = updData[updRow + c];
+                    else
+                        Reduce::apply(dst[dstIdx], updData[updRow + c]);
+                }
+            }
+            for (size_t k = 0; k < axisSize; k++) {
+                const size_t updRow = (outer * axisSize + k) * innerSize;
+                for (size_t c = innerBegin; c < innerEnd; c++) {
+                    if (!getDstIdx(updRow + c, c, dstIdx) || counters[dstIdx] == 0)
+                        continue;
+                    if (std::is_same<Reduce, ReduceMean>::value)
+                        dst[dstIdx] = arithmeticMean(dst[dstIdx], counters[dstIdx] + static_cast<int32_t>(useInitVal));
+                    counters[dstIdx] = 0;
+                }
+            }
+            return;
+        }
+
+        for (size_t k = 0; k < axisSize; k++) {
+            const size_t updRow = (outer * axisSize + k) * innerSize;
+            const IndexType *idxRow = idxData + updRow;
+            const DataType *updRowData = updData + updRow;
+            // the rows of the updates scattered as a whole, as the message passing of the graph networks does,
+            // are reduced by the contiguous vectorizable loop
+            bool uniform = innerDense;
+            for (size_t c = innerBegin + 1; c < innerEnd && uniform; c++)
+                uniform = idxRow[c] == idxRow[innerBegin];
+            if (uniform) {
+                int64_t idxValue = static_cast<int64_t>(idxRow[innerBegin]);
+                if (idxValue < 0)
+                    idxValue += dstAxisSize;
+                if (rowBegin <= idxValue && idxValue < rowEnd) {
+                    DataType *dstRow = dst + dstOuterOffset + idxValue * dstAxisStride;
+                    for (size_t c = innerBegin; c < innerEnd; c++)
+                        Reduce::apply(dstRow[c], updRowData[c]);
                 }
+                continue;
+            }
+            size_t dstIdx = 0;
+            for (size_t c = innerBegin; c < innerEnd; c++) {
+                if (getDstIdx(updRow + c, c, dstIdx))
+                    Reduce::apply(dst[dstIdx], updRowData[c]);
             }
         }
     });
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <openvino/op/scatter_elements_update.hpp>
 
 namespace ov {
 namespace intel_cpu {
@@ -41,9 +42,18 @@ public:
 private:
     void scatterUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
     void scatterNDUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, uint8_t *dstDataPtr);
+    template <typename DataType, typename IndexType>
     void scatterElementsUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    template <typename DataType, typename IndexType, typename Reduce>
+    void scatterElementsUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    template <typename DataType, typename IndexType, typename Reduce, typename OuterOffset>
+    bool scatterElementsUpdateRows(const IndexType *idxData, const DataType *updData, DataType *dst, size_t updRows,
+                                   size_t axisSize, size_t innerSize, size_t dstRows, const OuterOffset& getOuterOffset,
+                                   int64_t dstAxisSize, bool withCounters);
     inline int64_t getIndicesValue(uint8_t *indices, size_t offset);
 
+    using Reduction = ov::op::v12::ScatterElementsUpdate::Reduction;
+
     ScatterUpdateMode scatterUpdateMode = ScatterUpdateMode::ScatterUpdate;
     enum { DATA_ID, INDICES_ID, UPDATE_ID, AXIS_ID };
 
@@ -51,6 +61,34 @@ private:
     bool axisRelaxed = false;
     size_t dataSize, indicesSize, axisSize;
     InferenceEngine::Precision dataPrec, indicesPrec, axisPrec;
+    // the reduction of opset12 ScatterElementsUpdate
+    Reduction reduction = Reduction::NONE;
+    bool useInitVal = true;
+    std::vector<int32_t> reductionCounters;
+    // the update rows bucketed by the ranges of the output rows they are scattered to
+    std::vector<int64_t> updRowTargets;
+    std::vector<size_t> rowBucketOffsets;
+    std::vector<size_t> rowBucketBegins;
+    std::vector<size_t> rowBuckets;
+
+    struct ScatterElementsUpdateContext {
+        ScatterUpdate* node;
+        uint8_t *indicesPtr;
+        uint8_t *updatePtr;
+        int axis;
+        uint8_t *dstDataPtr;
+    };
+
+    template<typename T>
+    struct ScatterElementsUpdateDispatcher {
+        void operator()(ScatterElementsUpdateContext& ctx) {
+            if (ctx.node->indicesSize == sizeof(int32_t)) {
+                ctx.node->scatterElementsUpdate<T, int32_t>(ctx.indicesPtr, ctx.updatePtr, ctx.axis, ctx.dstDataPtr);
+            } else {
+                ctx.node->scatterElementsUpdate<T, int64_t>(ctx.indicesPtr, ctx.updatePtr, ctx.axis, ctx.dstDataPtr);
+            }
+        }
+    };
 
     std::string errorPrefix;
 };
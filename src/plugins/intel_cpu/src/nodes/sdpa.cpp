@@ -0,0 +1,377 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "sdpa.h"
+#include "ie_parallel.hpp"
+#include <cpu/x64/jit_generator.hpp>
+#include "emitters/x64/jit_dnnl_emitters.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include "shape_inference/custom/sdpa.hpp"
+
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+// the exponents of the scores are the only transcendental part of the node, the scalar std::exp would dominate
+// the blocks with the small head sizes
+template <cpu_isa_t isa>
+struct jit_exp_sum_kernel : public jit_uni_exp_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_exp_sum_kernel)
+
+    jit_exp_sum_kernel() : jit_uni_exp_sum_kernel(cpu_isa_traits<isa>::vlen / sizeof(float)), jit_generator(jit_name()) {
+        exp_emitter = std::make_shared<jit_dnnl_aux_emitter>(this, isa, dnnl_eltwise_exp, 0.f, 0.f);
+    }
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == cpu_isa_t::sse41, Xmm, isa == cpu_isa_t::avx2, Ymm, Zmm>::type;
+
+    void generate() override {
+        this->preamble();
+
+#define GET_OFF(field) offsetof(jit_exp_sum_call_args, field)
+        mov(reg_data, ptr[reg_params + GET_OFF(p_data)]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(p_max)]);
+        uni_vbroadcastss(vmm_max, ptr[reg_tmp]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label);
+        {
+            cmp(reg_work_amount, vec_size);
+            jl(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_data]);
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            exp_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+                                   pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            uni_vmovups(ptr[reg_data], vmm_val);
+
+            add(reg_data, vec_size * sizeof(float));
+            sub(reg_work_amount, vec_size);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF(p_sums)]);
+        uni_vmovups(ptr[reg_tmp], vmm_sum);
+#undef GET_OFF
+
+        this->postamble();
+
+        exp_emitter->emit_data();
+    }
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_max = Vmm(1);
+    Vmm vmm_sum = Vmm(2);
+
+    Reg64 reg_data = r8;
+    Reg64 reg_work_amount = r9;
+    Reg64 reg_tmp = r10;
+    Reg64 reg_params = abi_param1;
+
+    const std::vector<size_t> pool_aux_gpr_idxs = { static_cast<size_t>(rsi.getIdx()), static_cast<size_t>(rbp.getIdx()) };
+    const std::vector<size_t> pool_aux_vmm_idxs = { 12, 13, 14, 15 };
+
+    std::shared_ptr<jit_dnnl_aux_emitter> exp_emitter = nullptr;
+};
+
+#endif // OPENVINO_ARCH_X86_64
+
+namespace {
+
+// the scores of a block of queries and keys, the partial results and the keys and values fit L2
+constexpr size_t queryBlockSize = 32;
+constexpr size_t keyBlockSize = 256;
+
+template <typename T>
+const float* toFloat(const T* src, size_t size, float* buf) {
+    for (size_t i = 0; i < size; i++)
+        buf[i] = static_cast<float>(src[i]);
+    return buf;
+}
+
+template <>
+const float* toFloat<float>(const float* src, size_t size, float* buf) {
+    return src;
+}
+
+// offsets of the matrices of the input for each batch of the output, dims are aligned to the right
+std::vector<size_t> getBatchOffsets(const VectorDims& dims, const VectorDims& outDims, size_t& matrixRows, size_t& matrixCols) {
+    const size_t batchRank = outDims.size() - 2;
+    VectorDims alignedDims(outDims.size(), 1);
+    std::copy(dims.begin(), dims.end(), alignedDims.end() - dims.size());
+
+    matrixRows = alignedDims[batchRank];
+    matrixCols = alignedDims[batchRank + 1];
+    VectorDims strides(batchRank, 0);
+    size_t stride = matrixRows * matrixCols;
+    for (size_t i = batchRank; i-- > 0;) {
+        strides[i] = alignedDims[i] == 1 ? 0 : stride;
+        stride *= alignedDims[i];
+    }
+
+    const size_t batchSize = std::accumulate(outDims.begin(), outDims.begin() + batchRank, size_t(1), std::multiplies<size_t>());
+    std::vector<size_t> offsets(batchSize, 0);
+    for (size_t b = 0; b < batchSize; b++) {
+        size_t idx = b;
+        for (size_t i = batchRank; i-- > 0;) {
+            offsets[b] += (idx % outDims[i]) * strides[i];
+            idx /= outDims[i];
+        }
+    }
+    return offsets;
+}
+
+}   // namespace
+
+bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto sdpa = ov::as_type_ptr<const ScaledDotProductAttentionNode>(op);
+        if (!sdpa) {
+            errorMessage = "Only ScaledDotProductAttention from CPU internal opset is supported";
+            return false;
+        }
+        for (size_t i = 0; i < op->get_input_size(); i++) {
+            if (op->get_input_partial_shape(i).rank().is_dynamic()) {
+                errorMessage = "Doesn't support inputs with dynamic rank";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, SDPAShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    const auto sdpa = ov::as_type_ptr<const ScaledDotProductAttentionNode>(op);
+    scale = sdpa->get_scale();
+    causal = sdpa->get_causal();
+    hasMask = op->get_input_size() == 4;
+
+    // the kernel doesn't depend on the shapes, the scalar loop is the fallback
+#if defined(OPENVINO_ARCH_X86_64)
+    if (mayiuse(cpu_isa_t::avx512_core)) {
+        expSumKernel.reset(new jit_exp_sum_kernel<cpu_isa_t::avx512_core>());
+    } else if (mayiuse(cpu_isa_t::avx2)) {
+        expSumKernel.reset(new jit_exp_sum_kernel<cpu_isa_t::avx2>());
+    } else if (mayiuse(cpu_isa_t::sse41)) {
+        expSumKernel.reset(new jit_exp_sum_kernel<cpu_isa_t::sse41>());
+    }
+#endif // OPENVINO_ARCH_X86_64
+    if (expSumKernel)
+        expSumKernel->create_ker();
+}
+
+float ScaledDotProductAttention::expSum(float* row, size_t n, float max) const {
+    float sum = 0.f;
+    size_t j = 0;
+    if (expSumKernel) {
+        // the widest vector register holds 16 floats
+        float sums[16];
+        const auto vecSize = expSumKernel->vec_size;
+        jit_exp_sum_call_args args;
+        args.p_data = row;
+        args.p_max = &max;
+        args.p_sums = sums;
+        args.work_amount = n / vecSize * vecSize;
+        (*expSumKernel)(&args);
+        sum = std::accumulate(sums, sums + vecSize, 0.f);
+        j = args.work_amount;
+    }
+    for (; j < n; j++) {
+        row[j] = std::exp(row[j] - max);
+        sum += row[j];
+    }
+    return sum;
+}
+
+void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    dataPrecision = getOriginalInputPrecisionAtPort(0);
+    if (dataPrecision != InferenceEngine::Precision::BF16) {
+        dataPrecision = InferenceEngine::Precision::FP32;
+    }
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, dataPrecision});
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, dataPrecision}},
+                         gemm_any);
+}
+
+void ScaledDotProductAttention::prepareParams() {
+    const auto& queryDims = getParentEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    const auto& keyDims = getParentEdgeAt(1)->getMemoryPtr()->getStaticDims();
+    const auto& valueDims = getParentEdgeAt(2)->getMemoryPtr()->getStaticDims();
+    const auto& outDims = getChildEdgeAt(0)->getMemoryPtr()->getStaticDims();
+
+    size_t rows = 0, cols = 0;
+    queryOffsets = getBatchOffsets(queryDims, outDims, L, E);
+    keyOffsets = getBatchOffsets(keyDims, outDims, S, rows);
+    valueOffsets = getBatchOffsets(valueDims, outDims, rows, Ev);
+    if (hasMask) {
+        const auto& maskDims = getParentEdgeAt(3)->getMemoryPtr()->getStaticDims();
+        maskOffsets = getBatchOffsets(maskDims, outDims, rows, cols);
+        maskRowStride = rows == 1 ? 0 : cols;
+        maskColStride = cols == 1 ? 0 : 1;
+    }
+
+    // per thread: the converted blocks of queries, keys and values (BF16 only), the scores, the accumulator,
+    // the running maximum and sum of the rows
+    scratchPerThread = queryBlockSize * keyBlockSize + queryBlockSize * Ev + 2 * queryBlockSize;
+    if (dataPrecision != InferenceEngine::Precision::FP32)
+        scratchPerThread += queryBlockSize * E + keyBlockSize * (E + Ev);
+    scratch.resize(scratchPerThread * parallel_get_max_threads());
+}
+
+template <typename T>
+void ScaledDotProductAttention::executeImpl() {
+    const auto* query = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->getData());
+    const auto* key = reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->getData());
+    const auto* value = reinterpret_cast<const T*>(getParentEdgeAt(2)->getMemoryPtr()->getData());
+    const auto* mask = hasMask ? reinterpret_cast<const T*>(getParentEdgeAt(3)->getMemoryPtr()->getData()) : nullptr;
+    auto* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+
+    const auto& checkpoint = *context->getInferCheckpoint();
+    const float negInf = -std::numeric_limits<float>::infinity();
+    std::atomic<bool> gemmFailed{false};
+    std::atomic<bool> interrupted{false};
+
+    parallel_for2d(queryOffsets.size(), div_up(L, queryBlockSize), [&](size_t b, size_t lb) {
+        if (gemmFailed)
+            return;
+        if (checkpoint.isInterrupted()) {
+            interrupted.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        float* scores = scratch.data() + parallel_get_thread_num() * scratchPerThread;
+        float* acc = scores + queryBlockSize * keyBlockSize;
+        float* rowMax = acc + queryBlockSize * Ev;
+        float* rowSum = rowMax + queryBlockSize;
+        float* queryBuf = rowSum + queryBlockSize;
+        float* keyBuf = queryBuf + queryBlockSize * E;
+        float* valueBuf = keyBuf + keyBlockSize * E;
+
+        const size_t l0 = lb * queryBlockSize;
+        const size_t m = std::min(queryBlockSize, L - l0);
+        const float* q = toFloat(query + queryOffsets[b] + l0 * E, m * E, queryBuf);
+        std::fill(acc, acc + m * Ev, 0.f);
+        std::fill(rowMax, rowMax + m, negInf);
+        std::fill(rowSum, rowSum + m, 0.f);
+
+        // the causal queries of the block don't attend to the keys following the last of them
+        const size_t keyEnd = causal ? std::min(S, l0 + m) : S;
+        for (size_t s0 = 0; s0 < keyEnd; s0 += keyBlockSize) {
+            const size_t n = std::min(keyBlockSize, keyEnd - s0);
+            const float* k = toFloat(key + keyOffsets[b] + s0 * E, n * E, keyBuf);
+            const float* v = toFloat(value + valueOffsets[b] + s0 * Ev, n * Ev, valueBuf);
+
+            if (dnnl::sgemm('N', 'T', m, n, E, scale, q, E, k, E, 0.f, scores, n) != dnnl::status::success) {
+                gemmFailed = true;
+                return;
+            }
+
+            for (size_t i = 0; i < m; i++) {
+                float* row = scores + i * n;
+                if (mask) {
+                    const T* maskRow = mask + maskOffsets[b] + (l0 + i) * maskRowStride + s0 * maskColStride;
+                    for (size_t j = 0; j < n; j++)
+                        row[j] += static_cast<float>(maskRow[j * maskColStride]);
+                }
+                if (causal) {
+                    for (size_t j = l0 + i < s0 ? 0 : l0 + i + 1 - s0; j < n; j++)
+                        row[j] = negInf;
+                }
+
+                const float newMax = std::max(rowMax[i], *std::max_element(row, row + n));
+                if (newMax == negInf) {
+                    // the keys of the block are masked out for this query
+                    std::fill(row, row + n, 0.f);
+                    continue;
+                }
+                const float sum = expSum(row, n, newMax);
+                const float correction = std::exp(rowMax[i] - newMax);
+                if (correction != 1.f) {
+                    for (size_t j = 0; j < Ev; j++)
+                        acc[i * Ev + j] *= correction;
+                }
+                rowSum[i] = rowSum[i] * correction + sum;
+                rowMax[i] = newMax;
+            }
+
+            if (dnnl::sgemm('N', 'N', m, Ev, n, 1.f, scores, n, v, Ev, 1.f, acc, Ev) != dnnl::status::success) {
+                gemmFailed = true;
+                return;
+            }
+        }
+
+        // the rows with all the keys masked out get NaN as the reference softmax does, no keys at all give zeros
+        T* out = dst + (b * L + l0) * Ev;
+        for (size_t i = 0; i < m; i++) {
+            const float norm = S == 0 ? 0.f : 1.f / rowSum[i];
+            for (size_t j = 0; j < Ev; j++)
+                out[i * Ev + j] = static_cast<T>(acc[i * Ev + j] * norm);
+        }
+    });
+
+    if (interrupted)
+        checkpoint.check();
+    if (gemmFailed) {
+        IE_THROW() << "ScaledDotProductAttention node with name '" << getName() << "' failed to execute the matrix multiplication";
+    }
+}
+
+void ScaledDotProductAttention::execute(dnnl::stream strm) {
+    if (dataPrecision == InferenceEngine::Precision::BF16) {
+        executeImpl<bfloat16_t>();
+    } else {
+        executeImpl<float>();
+    }
+}
+
+void ScaledDotProductAttention::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool ScaledDotProductAttention::created() const {
+    return getType() == Type::ScaledDotProductAttention;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+struct jit_exp_sum_call_args {
+    float* p_data;        // the values are replaced by their exponents in place
+    const float* p_max;   // subtracted from the values before the exponent
+    float* p_sums;        // partial sums of the exponents, a vector register wide
+    size_t work_amount;   // a multiple of the vector length
+};
+
+struct jit_uni_exp_sum_kernel {
+    void (*ker_)(const jit_exp_sum_call_args*);
+
+    void operator()(const jit_exp_sum_call_args* call_args) {
+        assert(ker_);
+        ker_(call_args);
+    }
+
+    explicit jit_uni_exp_sum_kernel(size_t vec_size) : ker_(nullptr), vec_size(vec_size) {}
+    virtual ~jit_uni_exp_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    const size_t vec_size;
+};
+
+/**
+ * Scaled dot product attention computed block by block (flash attention): a block of queries is multiplied by the
+ * blocks of keys one after another, the softmax is computed online by rescaling the partial results when the running
+ * maximum of the row changes, so the whole [L, S] scores matrix is never materialized and the memory footprint
+ * doesn't depend on the sequence lengths. The node has no shape specific primitives, so the dynamic sequence lengths
+ * cost only the recomputation of the offsets in prepareParams.
+ */
+class ScaledDotProductAttention : public Node {
+public:
+    ScaledDotProductAttention(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    template <typename T>
+    void executeImpl();
+    // replaces the scores of the row by exp(score - max) and returns their sum
+    float expSum(float* row, size_t n, float max) const;
+
+    float scale = 1.f;
+    bool causal = false;
+    bool hasMask = false;
+    InferenceEngine::Precision dataPrecision = InferenceEngine::Precision::FP32;
+
+    size_t L = 0;
+    size_t S = 0;
+    size_t E = 0;
+    size_t Ev = 0;
+
+    // offsets of the matrices of the inputs for each output batch, the broadcast dimensions have zero stride
+    std::vector<size_t> queryOffsets;
+    std::vector<size_t> keyOffsets;
+    std::vector<size_t> valueOffsets;
+    std::vector<size_t> maskOffsets;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    size_t scratchPerThread = 0;
+    std::vector<float> scratch;
+
+    std::unique_ptr<jit_uni_exp_sum_kernel> expSumKernel;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
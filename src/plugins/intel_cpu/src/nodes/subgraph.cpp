@@ -6,6 +6,7 @@
 
 #include <ie_parallel.hpp>
 
+#include <atomic>
 #include <vector>
 #include <algorithm>
 #include <array>
@@ -48,6 +49,8 @@ namespace {
 
 struct SnippetKey {
     Snippet::SnippetAttrs attrs;
+    // the executors are shared by the compiled models with different configurations
+    bool enforceBF16;
 
     size_t hash() const;
     bool operator==(const SnippetKey& rhs) const;
@@ -73,12 +76,13 @@ size_t SnippetKey::hash() const {
         seed = hash_combine(seed, prec.getPrecVal());
 
     seed = hash_combine(seed, attrs.bodyHash);
+    seed = hash_combine(seed, enforceBF16);
 
     return seed;
 }
 
 bool SnippetKey::operator==(const SnippetKey& rhs) const {
-    if (attrs.bodyHash != rhs.attrs.bodyHash)
+    if (attrs.bodyHash != rhs.attrs.bodyHash || enforceBF16 != rhs.enforceBF16)
         return false;
     if (attrs.inMemBlockedDims.size() != rhs.attrs.inMemBlockedDims.size() ||
         attrs.inMemOrders.size() != rhs.attrs.inMemOrders.size() ||
@@ -117,6 +121,40 @@ bool SnippetKey::operator==(const SnippetKey& rhs) const {
     return true;
 }
 
+struct SnippetKernelKey {
+    uint64_t bodyHash;
+    // orders and precisions of the inputs followed by the outputs
+    std::vector<std::vector<size_t>> memOrders;
+    std::vector<InferenceEngine::Precision> memPrecs;
+    // the innermost dimension of the domain followed by the ones of the inputs and the outputs, the kernel doesn't depend
+    // on the outer dimensions
+    VectorDims innermostDims;
+    bool enforceBF16;
+
+    size_t hash() const;
+    bool operator==(const SnippetKernelKey& rhs) const;
+};
+
+size_t SnippetKernelKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = hash_combine(0, bodyHash);
+    for (const auto& order : memOrders)
+        seed = get_vector_hash(seed, order);
+    for (const auto& prec : memPrecs)
+        seed = hash_combine(seed, prec.getPrecVal());
+    seed = get_vector_hash(seed, innermostDims);
+    seed = hash_combine(seed, enforceBF16);
+
+    return seed;
+}
+
+bool SnippetKernelKey::operator==(const SnippetKernelKey& rhs) const {
+    return bodyHash == rhs.bodyHash && enforceBF16 == rhs.enforceBF16 && memOrders == rhs.memOrders &&
+           memPrecs == rhs.memPrecs && innermostDims == rhs.innermostDims;
+}
+
 snippets::op::Subgraph::BlockedShapeVector getBlockedShapes(const std::vector<std::vector<size_t>>& memBlockedDims,
         const std::vector<std::vector<size_t>>& memOrders, const std::vector<InferenceEngine::Precision>& memPrecs) {
     size_t numShapes = memBlockedDims.size();
@@ -356,21 +394,29 @@ void Snippet::prepareParams() {
     for (size_t i = 0; i < outputNum; i++)
         snippetAttrs.outMemBlockedDims[i] = getChildEdgesAtPort(i)[0]->getMemory().getDescWithType<BlockedMemoryDesc>()->getBlockDims();
 
-    SnippetKey key = {snippetAttrs};
+    SnippetKey key = {snippetAttrs, context->getConfig().inferencePrecision == ov::element::bf16};
 
-    auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
+    auto cache = context->getParamsCache();
+    auto builder = [this, &cache](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
         std::shared_ptr<SnippetExecutor> executor = std::make_shared<SnippetJitExecutor>(key.attrs, is_canonicalized,
-            is_dynamic, context->getConfig().inferencePrecision == ov::element::bf16);
+            is_dynamic, key.enforceBF16, cache);
         is_canonicalized = true;
         return executor;
     };
 
-    auto cache = context->getParamsCache();
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
     if (!execPtr) {
         IE_THROW() << "Executor is not created for node " << getName() << ".";
     }
+
+    const auto bufferScratchpadSize = execPtr->getBufferScratchpadSize();
+    if (bufferScratchpadSize > 0) {
+        auto bufferScratchpadDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{bufferScratchpadSize}));
+        bufferScratchpadMem = getScratchPadMem(bufferScratchpadDesc);
+    } else {
+        bufferScratchpadMem = nullptr;
+    }
 }
 
 bool Snippet::needPrepareParams() const {
@@ -416,74 +462,109 @@ void Snippet::execute(dnnl::stream strm) {
     for (size_t i = 0; i < outputNum; i++)
         dstMemPtrs[i] = getChildEdgeAt(i)->getMemoryPtr();
 
-    execPtr->exec(srcMemPtrs, dstMemPtrs);
+    auto bufferScratchpad = bufferScratchpadMem ? reinterpret_cast<uint8_t*>(bufferScratchpadMem->getData()) : nullptr;
+    const auto& checkpoint = *context->getInferCheckpoint();
+    // the interruption is reported only if it skipped a part of the work, a completed execution is not lost
+    if (!execPtr->exec(srcMemPtrs, dstMemPtrs, bufferScratchpad, checkpoint))
+        checkpoint.check();
 }
 
 void Snippet::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
-void Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+bool Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                                       uint8_t* bufferScratchpad, const InferCheckpoint& checkpoint) {
     if (schedule.ptr == nullptr) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
-    auto initStartMemoryOffsets = [this, &inMemPtrs, &outMemPtrs]() {
-        for (size_t i = 0; i < numInput; i++) {
-            start_offset_in[i] = inMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i];
-        }
-        for (size_t i = 0; i < numOutput; i++) {
-            start_offset_out[i] = outMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i + numInput];
-        }
-    };
-    // initialize start offsets to src and dst memory
+    if (buffer_scratchpad_size > 0 && bufferScratchpad == nullptr) {
+        IE_THROW() << "Snippet requires the buffer scratchpad, but it is not provided";
+    }
+    // initialize src and dst memory pointers including the start offsets
     // Needs to be done for every set of infer, as data memory ptrs could've updated
-    initStartMemoryOffsets();
+    jit_snippets_call_args base_args;
+    for (size_t i = 0; i < numInput; i++) {
+        const auto start_offset = inMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i];
+        base_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(inMemPtrs[i]->getData()) + start_offset;
+    }
+    for (size_t i = 0; i < numOutput; i++) {
+        const auto start_offset = outMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i + numInput];
+        base_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(outMemPtrs[i]->getData()) + start_offset;
+    }
 
     if (tensorRank == rank6D) {
-        schedule_6d(inMemPtrs, outMemPtrs);
-    } else {
-        schedule_nt(inMemPtrs, outMemPtrs);
+        return schedule_6d(base_args, bufferScratchpad, checkpoint);
     }
+    return schedule_nt(base_args, bufferScratchpad, checkpoint);
 }
 
-void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args,
-    const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
-    for (size_t i = 0; i < inMemPtrs.size(); i++)
-        call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(inMemPtrs[i]->getData()) + start_offset_in[i];
-
-    for (size_t i = 0; i < outMemPtrs.size(); i++)
-        call_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(outMemPtrs[i]->getData()) + start_offset_out[i];
+size_t Snippet::SnippetJitExecutor::getBufferScratchpadSize() const {
+    return buffer_scratchpad_size * parallel_get_max_threads();
+}
 
+void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args, const jit_snippets_call_args& base_args,
+                                              uint8_t* bufferScratchpad) const {
+    call_args = base_args;
     if (buffer_scratchpad_size > 0) {
-        call_args.buffer_scratchpad_ptr =
-                reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
+        call_args.buffer_scratchpad_ptr = bufferScratchpad + parallel_get_thread_num() * buffer_scratchpad_size;
+    }
+}
+
+void Snippet::SnippetJitExecutor::apply_runtime_offsets(jit_snippets_call_args& call_args, const int64_t* indexes) const {
+    const size_t offsetRank = tensorRank - 1;
+    for (size_t i = 0; i < numInput + numOutput; i++) {
+        const size_t* offsets = dataOffsets.data() + i * offsetRank;
+        size_t offset = 0;
+        for (size_t j = 0; j < offsetRank; j++)
+            offset += indexes[j] * offsets[j];
+        if (i < numInput)
+            call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(call_args.src_ptrs[i]) + offset;
+        else
+            call_args.dst_ptrs[i - numInput] = reinterpret_cast<uint8_t*>(call_args.dst_ptrs[i - numInput]) + offset;
     }
 }
 
-void Snippet::SnippetJitExecutor::schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+bool Snippet::SnippetJitExecutor::schedule_6d(const jit_snippets_call_args& base_args, uint8_t* bufferScratchpad,
+                                              const InferCheckpoint& checkpoint) {
     const auto& dom = exec_domain;
+    // the thread seeing the interruption stops the others, since they don't know their position in the range
+    std::atomic<bool> interrupted{false};
     // < N, C, H, W > < 1, 1, N, C*H*W>
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
         [&](int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) {
+            if (d4 % checkpointInterval == 0 && checkpoint.isInterrupted())
+                interrupted.store(true, std::memory_order_relaxed);
+            if (interrupted.load(std::memory_order_relaxed))
+                return;
             int64_t indexes[] = {d0, d1, d2, d3, d4};
             jit_snippets_call_args call_args;
-            update_ptrs(call_args, inMemPtrs, outMemPtrs);
+            update_ptrs(call_args, base_args, bufferScratchpad);
+            if (!dataOffsets.empty())
+                apply_runtime_offsets(call_args, indexes);
 
             schedule.get_callable<kernel>()(indexes, &call_args);
         });
+    return !interrupted;
 }
 
-void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+bool Snippet::SnippetJitExecutor::schedule_nt(const jit_snippets_call_args& base_args, uint8_t* bufferScratchpad,
+                                              const InferCheckpoint& checkpoint) {
     const auto& work_size = exec_domain;
+    std::atomic<bool> interrupted{false};
     parallel_nt(0, [&](const int ithr, const int nthr) {
         jit_snippets_call_args call_args;
-        update_ptrs(call_args, inMemPtrs, outMemPtrs);
+        update_ptrs(call_args, base_args, bufferScratchpad);
 
         size_t start = 0, end = 0;
         splitter(harnessWorkAmount, nthr, ithr, start, end);
 
         std::vector<int64_t> indexes(work_size.size() - 1, 0);
         for (size_t iwork = start; iwork < end; ++iwork) {
+            if ((iwork - start) % checkpointInterval == 0 && checkpoint.isInterrupted()) {
+                interrupted.store(true, std::memory_order_relaxed);
+                break;
+            }
             size_t tmp = iwork;
             for (ptrdiff_t j = work_size.size() - 2; j >= 0; j--) {
                 indexes[j] = tmp % work_size[j];
@@ -493,17 +574,17 @@ void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMe
             schedule.get_callable<kernel>()(indexes.data(), &call_args);
         }
     });
+    return !interrupted;
 }
 
 Snippet::SnippetExecutor::SnippetExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16)
     : snippetAttrs(attrs), is_canonicalized(is_canonicalized), is_dynamic(is_dynamic), enforceBF16(enforceBF16) {}
 
-Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16) :
+Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16,
+                                                const MultiCachePtr& kernelCache) :
     SnippetExecutor(attrs, is_canonicalized, is_dynamic, enforceBF16) {
     numInput = snippetAttrs.inMemBlockedDims.size();
     numOutput = snippetAttrs.outMemBlockedDims.size();
-    start_offset_in.resize(numInput);
-    start_offset_out.resize(numOutput);
     auto local_copy = [this]() {
         ov::OutputVector subgraph_node_inputs;
         for (size_t i = 0; i < numInput; i++) {
@@ -526,14 +607,6 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     // false means canonicalization, determine master_shape on snippetAttrs.snippet.
     ov::PartialShape canonicalShape = canonicalizeBody(is_canonicalized);
 
-    if (is_dynamic) {
-        // we need a local snippets for generation, which will be adjusted based on input shapes possibily.
-        // The adjustment may be not compatible with new input shape in dynamic node, such as broadcastMove inserted.
-        local_copy();
-    } else {
-        snippet_for_generation = snippetAttrs.snippet;
-    }
-
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), canonicalShape.size());
     auto initDataSizes = [this]() {
@@ -548,7 +621,7 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     if (canonicalShape.is_dynamic())
         IE_THROW() << "Snippets: Canonicalization returned dynamic shape in static pipeline";
     masterShape = canonicalShape.get_shape();
-    const auto &body = snippet_for_generation->body_ptr();
+    const auto &body = snippetAttrs.snippet->body_ptr();
     normInputShapes.clear();
     for (const auto& p : body->get_parameters())
         normInputShapes.emplace_back(p->get_output_shape(0));
@@ -569,7 +642,13 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     tileRank = 1;
     bool dims_collapsed = false;
     fullWorkAmount = std::accumulate(masterShape.begin(), masterShape.end(), 1, std::multiplies<size_t>());
-    if (snippet_for_generation->has_domain_sensitive_ops()) {
+    // The innermost dimension is long enough to never be collapsed, so the kernel processes it only and can be
+    // reused by all the shapes with the same innermost dimensions of the domain and of the inputs and the outputs
+    const bool shapeAgnostic = is_dynamic && !snippetAttrs.snippet->has_domain_sensitive_ops() &&
+                               tensorRank == rank6D && masterShape.back() >= minimalJitWorkAmount;
+    if (shapeAgnostic) {
+        tileRank = 1;
+    } else if (snippetAttrs.snippet->has_domain_sensitive_ops()) {
         tileRank = 2;
     } else {
         dims_collapsed = optimizeExecDomain(normInputShapes, normOutputShapes, masterShape, tileRank);
@@ -587,6 +666,57 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
         dim = 1;
     }
 
+    if (shapeAgnostic) {
+        auto buildKernel = [&](const SnippetKernelKey& key) -> std::shared_ptr<SnippetJitKernel> {
+            local_copy();
+            snippet_for_generation->set_master_shape(ov::PartialShape(masterShape));
+            snippet_for_generation->set_tile_rank(tileRank);
+            jit_snippets_compile_args jcp;
+            jcp.master_shape = masterShape;
+            jcp.tile_rank = tileRank;
+            jcp.runtime_data_offsets = true;
+            generate(&jcp);
+            auto jitKernel = std::make_shared<SnippetJitKernel>();
+            jitKernel->snippet = snippet_for_generation;
+            jitKernel->schedule = schedule;
+            jitKernel->bufferScratchpadSize = snippet_for_generation->get_buffer_scratchpad_size();
+            return jitKernel;
+        };
+
+        SnippetKernelKey key;
+        key.bodyHash = snippetAttrs.bodyHash;
+        key.enforceBF16 = enforceBF16;
+        key.memOrders = snippetAttrs.inMemOrders;
+        key.memOrders.insert(key.memOrders.end(), snippetAttrs.outMemOrders.begin(), snippetAttrs.outMemOrders.end());
+        key.memPrecs = snippetAttrs.inMemPrecs;
+        key.memPrecs.insert(key.memPrecs.end(), snippetAttrs.outMemPrecs.begin(), snippetAttrs.outMemPrecs.end());
+        key.innermostDims.push_back(masterShape.back());
+        for (const auto& shape : normInputShapes)
+            key.innermostDims.push_back(shape.back());
+        for (const auto& shape : normOutputShapes)
+            key.innermostDims.push_back(shape.back());
+
+        std::shared_ptr<SnippetJitKernel> jitKernel;
+        if (kernelCache) {
+            jitKernel = kernelCache->getOrCreate(key, buildKernel).first;
+        } else {
+            jitKernel = buildKernel(key);
+        }
+        snippet_for_generation = jitKernel->snippet;
+        schedule = jitKernel->schedule;
+        buffer_scratchpad_size = jitKernel->bufferScratchpadSize;
+        initRuntimeDataOffsets();
+        return;
+    }
+
+    if (is_dynamic) {
+        // we need a local snippets for generation, which will be adjusted based on input shapes possibily.
+        // The adjustment may be not compatible with new input shape in dynamic node, such as broadcastMove inserted.
+        local_copy();
+    } else {
+        snippet_for_generation = snippetAttrs.snippet;
+    }
+
     if (dims_collapsed) {
         std::vector<ov::Shape> new_shapes;
         for (size_t i = 0; i < normInputShapes.size(); i++) {
@@ -605,7 +735,21 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     jcp.tile_rank = tileRank;
     generate(&jcp);
     buffer_scratchpad_size = snippet_for_generation->get_buffer_scratchpad_size();
-    buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
+}
+
+void Snippet::SnippetJitExecutor::initRuntimeDataOffsets() {
+    // the same strides as KernelEmitter embeds into the kernel when the shapes are static
+    const size_t offsetRank = tensorRank - 1;
+    dataOffsets.assign((numInput + numOutput) * offsetRank, 0);
+    for (size_t i = 0; i < numInput + numOutput; i++) {
+        const auto& shape = i < numInput ? normInputShapes[i] : normOutputShapes[i - numInput];
+        size_t* offsets = dataOffsets.data() + i * offsetRank;
+        size_t dimStep = dataSize[i];
+        for (size_t k = offsetRank; k-- > 0;) {
+            dimStep *= shape[k + 1];
+            offsets[k] = shape[k] != 1 ? dimStep : 0;
+        }
+    }
 }
 
 ov::PartialShape Snippet::SnippetJitExecutor::canonicalizeBody(bool reshape) {
@@ -626,7 +770,6 @@ ov::PartialShape Snippet::SnippetJitExecutor::canonicalizeBody(bool reshape) {
 bool Snippet::SnippetJitExecutor::optimizeExecDomain(std::vector<VectorDims>& inputShapes, std::vector<VectorDims>& outputShapes,
                                  VectorDims &domain, size_t& TileRank) const {
     const size_t minimalConcurrency = parallel_get_max_threads();
-    const size_t minimalJitWorkAmount = 256;
     const size_t ds = domain.size();
     if ( ds <= 2 || // not enough dimensions to collapse
          domain[ds-1] >= minimalJitWorkAmount || // There is enough work for 1D Tiles, no need to collapse
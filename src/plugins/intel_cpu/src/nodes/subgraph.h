@@ -78,6 +78,7 @@ private:
 
     std::vector<MemoryPtr> srcMemPtrs = {};
     std::vector<MemoryPtr> dstMemPtrs = {};
+    MemoryPtr bufferScratchpadMem = nullptr;
 
     mutable SnippetAttrs snippetAttrs;
     mutable bool is_canonicalized = false;
@@ -86,7 +87,12 @@ private:
     class SnippetExecutor {
         public:
             SnippetExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16);
-            virtual void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) = 0;
+            // the executor keeps no state between the calls, so it may be shared by the graphs executed simultaneously,
+            // the buffer scratchpad (if required) is provided by the caller
+            // the interrupted execution skips the rest of the work and returns false, the outputs are undefined then
+            virtual bool exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs, uint8_t* bufferScratchpad,
+                              const InferCheckpoint& checkpoint) = 0;
+            virtual size_t getBufferScratchpadSize() const { return 0; }
             virtual ~SnippetExecutor() = default;
 
         protected:
@@ -100,13 +106,30 @@ private:
 
     class SnippetJitExecutor : public SnippetExecutor {
         public:
-            SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16);
-            void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) override;
+            // the kernels generated for the dynamic shapes are shared through the kernel cache by the executors of the shapes
+            // differing in the outer dimensions only
+            SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16,
+                               const MultiCachePtr& kernelCache);
+            bool exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs, uint8_t* bufferScratchpad,
+                      const InferCheckpoint& checkpoint) override;
+            // size of the buffer scratchpad for all the threads of the stream
+            size_t getBufferScratchpadSize() const override;
 
             bool schedule_created();
 
         private:
             static const size_t rank6D {6};
+            // number of the kernel calls between the checks of the interruption
+            static const size_t checkpointInterval {16};
+            // the innermost dimension processed by a kernel call which makes the collapsing of the dimensions useless
+            static const size_t minimalJitWorkAmount {256};
+
+            // Generated code with the subgraph owning it
+            struct SnippetJitKernel {
+                std::shared_ptr<snippets::op::Subgraph> snippet;
+                snippets::Schedule schedule;
+                size_t bufferScratchpadSize = 0;
+            };
 
             typedef void (*kernel)(const void *, const void *);
 
@@ -118,10 +141,12 @@ private:
             bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
             void generate(const jit_snippets_compile_args*);
-            inline void update_ptrs(jit_snippets_call_args&, const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
+            void initRuntimeDataOffsets();
+            inline void update_ptrs(jit_snippets_call_args&, const jit_snippets_call_args& base_args, uint8_t* bufferScratchpad) const;
+            inline void apply_runtime_offsets(jit_snippets_call_args& call_args, const int64_t* indexes) const;
             // Evaluates generated snippet using parallel backend
-            void schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
-            void schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
+            bool schedule_6d(const jit_snippets_call_args& base_args, uint8_t* bufferScratchpad, const InferCheckpoint& checkpoint);
+            bool schedule_nt(const jit_snippets_call_args& base_args, uint8_t* bufferScratchpad, const InferCheckpoint& checkpoint);
 
             std::shared_ptr<snippets::op::Subgraph> snippet_for_generation;
 
@@ -146,12 +171,13 @@ private:
             mutable std::vector<VectorDims> normInputShapes = {};
             mutable std::vector<VectorDims> normOutputShapes = {};
 
-            std::vector<ptrdiff_t> start_offset_in = {};
-            std::vector<ptrdiff_t> start_offset_out = {};
-
-            // Buffer scratchpad
-            std::vector<uint8_t> buffer_scratchpad = {};
+            // Buffer scratchpad size per thread
             size_t buffer_scratchpad_size = 0;
+
+            // The kernel is shape agnostic: it's generated for the innermost dimension of the domain only, the executor applies
+            // the offsets of the outer dimensions (zero for the broadcast ones) to the data pointers of each call.
+            // Byte offsets of the outer dimensions for each input and output, empty if the kernel embeds them
+            std::vector<size_t> dataOffsets = {};
     };
 };
 
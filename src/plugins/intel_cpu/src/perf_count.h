@@ -55,3 +55,5 @@ public:
 
 #define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
 #define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_PERF_PREPARE(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfPrepareCounter()))
+#define PERF_PREPARE(_node, _need) auto pcPrepare = _need ? GET_PERF_PREPARE(_node) : nullptr;
@@ -12,6 +12,8 @@
 #include "extension_mngr.h"
 #include "extension.h"
 #include "serialize.h"
+#include "compiled_graph_cache.h"
+#include "graph_context.h"
 #include "threading/ie_executor_manager.hpp"
 
 #include "ie_icore.hpp"
@@ -20,6 +22,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "internal_properties.hpp"
 
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -617,6 +620,27 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
     } else if (name == ov::hint::execution_mode) {
         return engConfig.executionMode;
+    } else if (name == ov::intel_cpu::inter_op_parallelism) {
+        return decltype(ov::intel_cpu::inter_op_parallelism)::value_type(engConfig.interOpParallelism);
+    } else if (name == ov::intel_cpu::hybrid_node_placement) {
+        return decltype(ov::intel_cpu::hybrid_node_placement)::value_type(engConfig.hybridNodePlacement);
+    } else if (name == ov::intel_cpu::numa_local_activations) {
+        return decltype(ov::intel_cpu::numa_local_activations)::value_type(engConfig.numaLocalActivations);
+    } else if (name == ov::intel_cpu::dynamic_memory_arena) {
+        return decltype(ov::intel_cpu::dynamic_memory_arena)::value_type(engConfig.dynamicMemoryArena);
+    } else if (name == ov::intel_cpu::state_slots) {
+        return decltype(ov::intel_cpu::state_slots)::value_type(engConfig.stateSlots);
+    } else if (name == ov::intel_cpu::latency_budget) {
+        return decltype(ov::intel_cpu::latency_budget)::value_type(engConfig.latencyBudget);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        switch (engConfig.hugePagesMode) {
+        case HugePagesMode::Transparent:
+            return decltype(ov::intel_cpu::huge_pages)::value_type("TRANSPARENT");
+        case HugePagesMode::Explicit:
+            return decltype(ov::intel_cpu::huge_pages)::value_type("EXPLICIT");
+        default:
+            return decltype(ov::intel_cpu::huge_pages)::value_type(PluginConfigParams::NO);
+        }
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -722,7 +746,14 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (ov::internal::supported_properties == name) {
         return decltype(ov::internal::supported_properties)::value_type{
             ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW}};
+            ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::inter_op_parallelism.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::hybrid_node_placement.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::numa_local_activations.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::dynamic_memory_arena.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::state_slots.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::latency_budget.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::intel_cpu::huge_pages.name(), ov::PropertyMutability::RW}};
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
@@ -820,6 +851,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
+    auto compiledCache = CompiledGraphCache::deserialize(networkModel, GraphContext::getEngine());
 
     auto function = cnnnetwork.getFunction();
     Config::ModelType modelType = getModelType(function);
@@ -828,7 +860,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CalculateStreams(conf, function, true);
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), compiledCache);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
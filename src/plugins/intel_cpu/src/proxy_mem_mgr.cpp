@@ -20,7 +20,7 @@ void ProxyMemoryMngr::setMemMngr(std::shared_ptr<IMemoryMngr> pMngr) {
 
 void ProxyMemoryMngr::reset() {
     if (!m_pOrigMngr) {
-        m_pOrigMngr = std::make_shared<MemoryMngrWithReuse>();
+        m_pOrigMngr = std::make_shared<MemoryMngrWithReuse>(MemoryMngrWithReuse::dynamicGrowthFactor);
     }
 
     if (m_pMngr == m_pOrigMngr) {
@@ -14,7 +14,8 @@ namespace intel_cpu {
  */
 class ProxyMemoryMngr : public IMemoryMngrObserver {
 public:
-    ProxyMemoryMngr() : m_pOrigMngr(std::make_shared<MemoryMngrWithReuse>()), m_pMngr(m_pOrigMngr) {}
+    ProxyMemoryMngr() : m_pOrigMngr(std::make_shared<MemoryMngrWithReuse>(MemoryMngrWithReuse::dynamicGrowthFactor)),
+                        m_pMngr(m_pOrigMngr) {}
     explicit ProxyMemoryMngr(std::shared_ptr<IMemoryMngr> pMngr) {
         OPENVINO_ASSERT(pMngr, "Memory manager is uninitialized");
         m_pMngr = pMngr;
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include "sdpa.hpp"
+#include "utils.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+Result SDPAShapeInfer::infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    const auto& queryDims = input_shapes[0].get();
+    const auto& valueDims = input_shapes[2].get();
+    const size_t rank = queryDims.size();
+
+    // the leading dimensions of the inputs are broadcast, the mask may have a smaller rank
+    VectorDims outputDims(rank, 1);
+    for (const auto& input : input_shapes) {
+        const auto& dims = input.get();
+        const size_t batchRank = dims.size() < 2 ? 0 : dims.size() - 2;
+        for (size_t i = 0; i < batchRank; i++) {
+            auto& dim = outputDims[rank - 2 - batchRank + i];
+            if (dim == 1) {
+                dim = dims[i];
+            } else if (dims[i] != 1 && dims[i] != dim) {
+                OPENVINO_THROW("Incompatible ScaledDotProductAttention batch dimension ", dims[i], " and ", dim, " at index ", i);
+            }
+        }
+    }
+    outputDims[rank - 2] = queryDims[rank - 2];
+    outputDims[rank - 1] = valueDims[rank - 1];
+    return {{std::move(outputDims)}, ShapeInferStatus::success};
+}
+
+ShapeInferPtr SDPAShapeInferFactory::makeShapeInfer() const {
+    auto sdpa = ov::as_type_ptr<ScaledDotProductAttentionNode>(m_op);
+    if (!sdpa) {
+        OPENVINO_THROW("Wrong operation type");
+    }
+    return std::make_shared<SDPAShapeInfer>();
+}
+} // namespace node
+} // namespace intel_cpu
+} // namespace ov
@@ -0,0 +1,243 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_streams_pool.h"
+
+#include <algorithm>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace {
+
+// the shares of the models are recomputed at most once per this interval
+constexpr auto rebalanceInterval = std::chrono::milliseconds{10};
+
+// the model stream the current thread runs a task as
+thread_local const PooledStreamsExecutor* currentExecutor = nullptr;
+thread_local int currentStream = 0;
+// set when the task being run has released the last reference to its own executor
+thread_local bool currentExecutorReleased = false;
+
+struct CurrentStreamGuard {
+    CurrentStreamGuard(const PooledStreamsExecutor* executor, int stream)
+        : prevExecutor(currentExecutor), prevStream(currentStream) {
+        currentExecutor = executor;
+        currentStream = stream;
+    }
+    ~CurrentStreamGuard() {
+        currentExecutor = prevExecutor;
+        currentStream = prevStream;
+    }
+    const PooledStreamsExecutor* prevExecutor;
+    int prevStream;
+};
+
+}   // namespace
+
+PooledStreamsExecutor::PooledStreamsExecutor(std::shared_ptr<SharedStreamsPool> pool, int maxStreams)
+    : _pool(std::move(pool)), _maxStreams(std::max(1, maxStreams)), _busyStreams(_maxStreams, false) {}
+
+PooledStreamsExecutor::~PooledStreamsExecutor() {
+    _pool->unregister(*this);
+}
+
+void PooledStreamsExecutor::run(Task task) {
+    _pool->enqueue(*this, std::move(task));
+}
+
+void PooledStreamsExecutor::Execute(Task task) {
+    _pool->_streams->Execute(std::move(task));
+}
+
+int PooledStreamsExecutor::GetStreamId() {
+    return currentExecutor == this ? currentStream : 0;
+}
+
+int PooledStreamsExecutor::GetNumaNodeId() {
+    return _pool->_streams->GetNumaNodeId();
+}
+
+int PooledStreamsExecutor::GetSocketId() {
+    return _pool->_streams->GetSocketId();
+}
+
+int PooledStreamsExecutor::getAllowedStreams() const {
+    std::lock_guard<std::mutex> lock{_pool->_mutex};
+    return _allowed;
+}
+
+size_t PooledStreamsExecutor::getQueueDepth() const {
+    std::lock_guard<std::mutex> lock{_pool->_mutex};
+    return _tasks.size();
+}
+
+SharedStreamsPool::SharedStreamsPool(const ExecutorManager::Ptr& executorManager, const IStreamsExecutor::Config& config)
+    : _streamsNumber(std::max(1, config._streams)) {
+    auto poolConfig = config;
+    poolConfig._streams = _streamsNumber;
+    // the pool may be released by a task running on its streams, so it must not be the one which joins their threads
+    _streams = executorManager->getIdleCPUStreamsExecutor(poolConfig);
+}
+
+SharedStreamsPool::Ptr SharedStreamsPool::get(const ExecutorManager::Ptr& executorManager,
+                                              const IStreamsExecutor::Config& config) {
+    static std::mutex poolMutex;
+    static std::weak_ptr<SharedStreamsPool> processPool;
+    std::lock_guard<std::mutex> lock{poolMutex};
+    auto pool = processPool.lock();
+    if (!pool) {
+        pool = std::make_shared<SharedStreamsPool>(executorManager, config);
+        processPool = pool;
+    }
+    return pool;
+}
+
+PooledStreamsExecutor::Ptr SharedStreamsPool::createExecutor(int maxStreams) {
+    auto executor = std::make_shared<PooledStreamsExecutor>(shared_from_this(), maxStreams);
+    std::vector<PooledStreamsExecutor::Ptr> executors;
+    Drains drains;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _executors.push_back(executor);
+        rebalanceLocked(executors, drains);
+    }
+    post(drains);
+    return executor;
+}
+
+// called by the executor being destroyed, it has already expired, so no more drains are posted for it
+void SharedStreamsPool::unregister(PooledStreamsExecutor& executor) {
+    // the executor may be released by one of its own tasks, the drain running it must not wait for itself
+    const bool fromOwnTask = currentExecutor == &executor;
+    std::unique_lock<std::mutex> lock{_mutex};
+    _drained.wait(lock, [&] {
+        return executor._scheduled == 0 && executor._active == (fromOwnTask ? 1 : 0);
+    });
+    if (fromOwnTask)
+        currentExecutorReleased = true;
+    _executors.erase(std::remove_if(_executors.begin(),
+                                    _executors.end(),
+                                    [](const std::weak_ptr<PooledStreamsExecutor>& registered) {
+                                        return registered.expired();
+                                    }),
+                     _executors.end());
+    _lastRebalance = {};
+}
+
+void SharedStreamsPool::enqueue(PooledStreamsExecutor& executor, Task task) {
+    std::vector<PooledStreamsExecutor::Ptr> executors;
+    Drains drains;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        executor._tasks.push(std::move(task));
+        if (std::chrono::steady_clock::now() - _lastRebalance >= rebalanceInterval) {
+            rebalanceLocked(executors, drains);
+        } else if (const auto count = scheduleLocked(executor)) {
+            drains.emplace_back(&executor, count);
+        }
+    }
+    post(drains);
+}
+
+// returns the number of drains to post, so the waiting tasks of the executor are taken by the allowed streams
+int SharedStreamsPool::scheduleLocked(PooledStreamsExecutor& executor) {
+    const auto waiting = static_cast<int>(executor._tasks.size());
+    const auto count = std::min(waiting - executor._scheduled, executor._allowed - executor._active - executor._scheduled);
+    if (count <= 0)
+        return 0;
+    executor._scheduled += count;
+    return count;
+}
+
+// the executors are returned to the caller, so the last reference to an executor is not released under the lock
+void SharedStreamsPool::rebalanceLocked(std::vector<PooledStreamsExecutor::Ptr>& executors, Drains& drains) {
+    _lastRebalance = std::chrono::steady_clock::now();
+    size_t totalDemand = 0;
+    for (const auto& registered : _executors) {
+        if (auto executor = registered.lock()) {
+            totalDemand += executor->_tasks.size() + executor->_active;
+            executors.push_back(std::move(executor));
+        }
+    }
+    if (executors.empty())
+        return;
+
+    const auto streams = static_cast<size_t>(_streamsNumber);
+    for (const auto& executor : executors) {
+        // without any demand the streams are split evenly
+        const size_t demand = executor->_tasks.size() + executor->_active;
+        const size_t share = totalDemand == 0 ? (streams + executors.size() - 1) / executors.size()
+                                              : (streams * demand + totalDemand - 1) / totalDemand;
+        executor->_allowed = static_cast<int>(std::min<size_t>(std::max<size_t>(share, 1), executor->_maxStreams));
+        if (const auto count = scheduleLocked(*executor)) {
+            drains.emplace_back(executor.get(), count);
+        }
+    }
+}
+
+void SharedStreamsPool::post(const Drains& drains) {
+    for (const auto& executorDrains : drains) {
+        for (int i = 0; i < executorDrains.second; i++) {
+            auto executor = executorDrains.first;
+            // the last reference to the pool may be held by the executor released by the drained task
+            auto self = shared_from_this();
+            _streams->run([self, executor] {
+                self->drain(executor);
+            });
+        }
+    }
+}
+
+// runs one task of the executor on the current stream of the pool as one of the free streams of the model
+void SharedStreamsPool::drain(PooledStreamsExecutor* executor) {
+    Task task;
+    int stream = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        executor->_scheduled--;
+        if (executor->_tasks.empty() || executor->_active >= executor->_allowed) {
+            _drained.notify_all();
+            return;
+        }
+        task = std::move(executor->_tasks.front());
+        executor->_tasks.pop();
+        executor->_active++;
+        // the streams are taken round-robin, so the consequent tasks visit all the graphs of the model
+        auto& busy = executor->_busyStreams;
+        stream = executor->_nextStream;
+        while (busy[stream])
+            stream = (stream + 1) % executor->_maxStreams;
+        busy[stream] = true;
+        executor->_nextStream = (stream + 1) % executor->_maxStreams;
+    }
+
+    {
+        CurrentStreamGuard guard{executor, stream};
+        task();
+        task = {};
+    }
+    if (currentExecutorReleased) {
+        // the executor is destroyed, nothing else waits for this drain
+        currentExecutorReleased = false;
+        return;
+    }
+
+    Drains drains;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        executor->_busyStreams[stream] = false;
+        executor->_active--;
+        if (const auto count = scheduleLocked(*executor)) {
+            drains.emplace_back(executor, count);
+        }
+        // the executor may be destroyed as soon as the lock is released
+        _drained.notify_all();
+    }
+    post(drains);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
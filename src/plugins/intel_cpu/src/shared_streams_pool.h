@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <threading/ie_executor_manager.hpp>
+#include <threading/ie_istreams_executor.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+class SharedStreamsPool;
+
+/**
+ * @brief Streams executor of a compiled model which runs the tasks on the streams of the SharedStreamsPool.
+ * The model occupies at most maxStreams streams of the pool at once, and GetStreamId() returns the index of the model
+ * stream (from 0 to maxStreams - 1) the current task runs as, so each model keeps using its own per stream graphs.
+ */
+class PooledStreamsExecutor : public InferenceEngine::IStreamsExecutor {
+public:
+    typedef std::shared_ptr<PooledStreamsExecutor> Ptr;
+
+    PooledStreamsExecutor(std::shared_ptr<SharedStreamsPool> pool, int maxStreams);
+    ~PooledStreamsExecutor() override;
+
+    void run(InferenceEngine::Task task) override;
+
+    void Execute(InferenceEngine::Task task) override;
+
+    int GetStreamId() override;
+
+    int GetNumaNodeId() override;
+
+    int GetSocketId() override;
+
+    /**
+     * @brief Returns the number of the pool streams the model may occupy at once, it's updated by the pool
+     * according to the queue depths of all the models
+     */
+    int getAllowedStreams() const;
+
+    /**
+     * @brief Returns the number of the tasks waiting for a stream
+     */
+    size_t getQueueDepth() const;
+
+private:
+    friend class SharedStreamsPool;
+
+    std::shared_ptr<SharedStreamsPool> _pool;
+    const int _maxStreams;
+
+    // guarded by the mutex of the pool
+    std::queue<InferenceEngine::Task> _tasks;
+    int _scheduled = 0;  // drains posted to the pool and not started yet
+    int _active = 0;     // tasks being executed
+    int _allowed = 1;
+    std::vector<bool> _busyStreams;
+    int _nextStream = 0;
+};
+
+/**
+ * @brief Process-wide pool of pinned streams shared by the compiled models instead of creating the streams per model.
+ * The core budget is the number of streams of the pool. Each model may occupy a share of the streams proportional to
+ * the number of its waiting and running tasks, so the streams follow the traffic when it moves from one model to
+ * another. The shares are recomputed at most once per rebalancing interval, nothing has to be recompiled.
+ */
+class SharedStreamsPool : public std::enable_shared_from_this<SharedStreamsPool> {
+public:
+    typedef std::shared_ptr<SharedStreamsPool> Ptr;
+
+    /**
+     * @brief Takes the streams from the executor manager, so they are owned by it the same way as the streams of
+     * the compiled models which don't use the pool
+     */
+    SharedStreamsPool(const InferenceEngine::ExecutorManager::Ptr& executorManager,
+                      const InferenceEngine::IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Returns the pool of the process, it's created with the given config if there is no one yet
+     */
+    static Ptr get(const InferenceEngine::ExecutorManager::Ptr& executorManager,
+                   const InferenceEngine::IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Creates an executor of a compiled model with the given number of per stream graphs
+     */
+    PooledStreamsExecutor::Ptr createExecutor(int maxStreams);
+
+    int getStreams() const {
+        return _streamsNumber;
+    }
+
+private:
+    friend class PooledStreamsExecutor;
+    // the drains refer to the executors by raw pointers, an executor waits for its drains before it's destroyed
+    using Drains = std::vector<std::pair<PooledStreamsExecutor*, int>>;
+
+    void enqueue(PooledStreamsExecutor& executor, InferenceEngine::Task task);
+    void drain(PooledStreamsExecutor* executor);
+    void unregister(PooledStreamsExecutor& executor);
+
+    int scheduleLocked(PooledStreamsExecutor& executor);
+    void rebalanceLocked(std::vector<PooledStreamsExecutor::Ptr>& executors, Drains& drains);
+    void post(const Drains& drains);
+
+    InferenceEngine::IStreamsExecutor::Ptr _streams;
+    const int _streamsNumber;
+    mutable std::mutex _mutex;
+    std::condition_variable _drained;
+    std::vector<std::weak_ptr<PooledStreamsExecutor>> _executors;
+    std::chrono::steady_clock::time_point _lastRebalance;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
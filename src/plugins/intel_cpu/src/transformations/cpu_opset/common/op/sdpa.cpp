@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ov::OutputVector& args,
+                                                                             const float scale,
+                                                                             const bool causal)
+    : Op(args), m_scale(scale), m_causal(causal) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::ScaledDotProductAttentionNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ScaledDotProductAttentionNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(new_args, m_scale, m_causal);
+}
+
+bool ov::intel_cpu::ScaledDotProductAttentionNode::visit_attributes(ov::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(ScaledDotProductAttentionNode_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("causal", m_causal);
+    return true;
+}
+
+void ov::intel_cpu::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ScaledDotProductAttentionNode_validate_and_infer_types);
+    const auto inputs_count = get_input_size();
+    NGRAPH_CHECK(inputs_count == 3 || inputs_count == 4, "expects 3 or 4 inputs whereas got ", inputs_count);
+
+    const auto& data_et = get_input_element_type(0);
+    NGRAPH_CHECK(data_et.is_real(), "'queries' input must be real whereas current element type is ", data_et);
+    for (size_t i = 1; i < inputs_count; i++) {
+        NGRAPH_CHECK(get_input_element_type(i).compatible(data_et),
+                     "all the inputs must have the same element type, got ", get_input_element_type(i), " and ", data_et);
+    }
+
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& k_shape = get_input_partial_shape(1);
+    const auto& v_shape = get_input_partial_shape(2);
+    if (q_shape.rank().is_dynamic() || k_shape.rank().is_dynamic() || v_shape.rank().is_dynamic()) {
+        set_output_type(0, data_et, ov::PartialShape::dynamic());
+        return;
+    }
+
+    const auto rank = q_shape.size();
+    NGRAPH_CHECK(rank >= 3, "'queries' input must have at least 3D shape whereas current shape is ", q_shape);
+    NGRAPH_CHECK(k_shape.size() == rank && v_shape.size() == rank,
+                 "the inputs must have the same rank, got ", q_shape, ", ", k_shape, " and ", v_shape);
+    NGRAPH_CHECK(q_shape[rank - 1].compatible(k_shape[rank - 1]),
+                 "the queries and the keys must have the same size, got ", q_shape, " and ", k_shape);
+    NGRAPH_CHECK(k_shape[rank - 2].compatible(v_shape[rank - 2]),
+                 "the keys and the values must have the same length, got ", k_shape, " and ", v_shape);
+
+    // the leading dimensions of all the inputs including the mask are broadcast
+    auto batch_shape = ov::PartialShape(std::vector<ov::Dimension>(q_shape.begin(), q_shape.end() - 2));
+    auto merge_batch = [&](const ov::PartialShape& shape) {
+        if (shape.rank().is_dynamic()) {
+            batch_shape = ov::PartialShape::dynamic(rank - 2);
+            return;
+        }
+        NGRAPH_CHECK(shape.size() <= rank, "the input shape ", shape, " has a bigger rank than the queries ", q_shape);
+        const auto batch_rank = std::max<int64_t>(0, static_cast<int64_t>(shape.size()) - 2);
+        auto shape_batch = ov::PartialShape(std::vector<ov::Dimension>(shape.begin(), shape.begin() + batch_rank));
+        NGRAPH_CHECK(ov::PartialShape::broadcast_merge_into(batch_shape, shape_batch, ov::op::AutoBroadcastType::NUMPY),
+                     "the leading dimensions of the inputs are not broadcastable, got ", q_shape, " and ", shape);
+    };
+    merge_batch(k_shape);
+    merge_batch(v_shape);
+    if (inputs_count == 4)
+        merge_batch(get_input_partial_shape(3));
+
+    std::vector<ov::Dimension> out_dims(batch_shape.begin(), batch_shape.end());
+    out_dims.push_back(q_shape[rank - 2]);
+    out_dims.push_back(v_shape[rank - 1]);
+    set_output_type(0, data_et, ov::PartialShape(out_dims));
+}
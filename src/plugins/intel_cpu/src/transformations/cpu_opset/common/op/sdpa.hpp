@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation computes the scaled dot product attention softmax(scale * Q * K^T + mask) * V, the softmax is taken over the keys.
+ * Inputs:
+ *     1. Queries of type T - shape [..., L, E]. Required
+ *     2. Keys of type T - shape [..., S, E]. Required
+ *     3. Values of type T - shape [..., S, Ev]. Required
+ *     4. Additive attention mask of type T - shape broadcastable to [..., L, S]. Optional
+ *     The leading dimensions of the inputs are broadcast to each other as the batch dimensions of MatMul.
+ * Outputs:
+ *     1. Attention of type T and of shape [..., L, Ev].
+ * Attributes:
+ *     scale - multiplier of the scores Q * K^T
+ *     causal - the query i attends to the keys 0..i only (the causal mask aligned to the top left corner),
+ *              applied together with the mask input if any
+ * Types:
+ *     T - FP32 and BF16 are supported
+ */
+class ScaledDotProductAttentionNode : public ov::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledDotProductAttentionNode() = default;
+    ScaledDotProductAttentionNode(const ov::OutputVector& args, const float scale, const bool causal);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    float get_scale() const {
+        return m_scale;
+    }
+
+    bool get_causal() const {
+        return m_causal;
+    }
+
+private:
+    float m_scale = 1.f;
+    bool m_causal = false;
+};
+}   // namespace intel_cpu
+}   // namespace ov
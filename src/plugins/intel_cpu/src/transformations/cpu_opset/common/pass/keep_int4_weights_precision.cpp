@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "keep_int4_weights_precision.hpp"
+#include <transformations/rt_info/keep_const_precision.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <openvino/pass/pattern/op/or.hpp>
+
+#include <openvino/op/constant.hpp>
+#include <openvino/op/convert.hpp>
+#include <openvino/op/subtract.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/reshape.hpp>
+#include <openvino/op/matmul.hpp>
+#include <openvino/op/fake_quantize.hpp>
+
+#include "itt.hpp"
+#include "utils/general_utils.h"
+
+ov::intel_cpu::KeepInt4WeightsPrecision::KeepInt4WeightsPrecision() {
+    MATCHER_SCOPE(KeepInt4WeightsPrecision);
+    using namespace ov::pass::pattern;
+    auto int4_weights = [](const ov::Output<ov::Node>& out) {
+        return consumers_count(1)(out) &&
+               (out.get_element_type() == ov::element::u4 || out.get_element_type() == ov::element::i4);
+    };
+    auto weights_m = wrap_type<ov::op::v0::Constant>(int4_weights);
+    auto convert_m = wrap_type<ov::op::v0::Convert>({weights_m}, consumers_count(1));
+
+    auto sub_const_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
+    auto subtract_m = wrap_type<ov::op::v1::Subtract>({convert_m, sub_const_m}, consumers_count(1));
+
+    auto mul_const_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
+    auto mul_with_sub_m = wrap_type<ov::op::v1::Multiply>({subtract_m, mul_const_m}, consumers_count(1));
+    auto mul_no_sub_m = wrap_type<ov::op::v1::Multiply>({convert_m, mul_const_m}, consumers_count(1));
+    auto mul_m = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{mul_with_sub_m, mul_no_sub_m});
+
+    auto reshape_const_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
+    auto reshape_m = wrap_type<ov::op::v1::Reshape>({mul_m, reshape_const_m}, consumers_count(1));
+    auto weights_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{mul_m, reshape_m});
+
+    auto data_m = any_input();
+    auto matmul_m = wrap_type<ov::op::v0::MatMul>({data_m, weights_input_m});
+
+    // The weights which are not marked are widened to u8 by ConvertPrecision and decompressed as usual, so only
+    // the patterns the FullyConnected node is guaranteed to decompress by itself are marked. The conditions follow
+    // FuseFCAndWeightsDecompression and the 4-bit weights limitations of the FullyConnected node.
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(m.get_match_root());
+        // the weights of the MatMul without transpose_b are transposed, the kernel doesn't support such layout
+        if (!matmul || matmul->get_transpose_a() || !matmul->get_transpose_b())
+            return false;
+
+        // the kernel supports the f32 and bf16 activations only (f16 is converted to f32 later), the quantized ones
+        // are executed in int8
+        const auto& data = pattern_map.at(data_m);
+        if (!one_of(data.get_element_type(), ov::element::f32, ov::element::bf16, ov::element::f16) ||
+            ov::is_type<ov::op::v0::FakeQuantize>(data.get_node()))
+            return false;
+
+        const auto weights = pattern_map.at(weights_m).get_node_shared_ptr();
+        const auto& weights_shape = weights->get_output_shape(0);
+        const bool with_reshape = pattern_map.count(reshape_m);
+        if (weights_shape.size() != (with_reshape ? 3 : 2))
+            return false;
+        // group-wise weights are reshaped to [OC, IC]
+        if (with_reshape) {
+            const auto& reshaped_shape = pattern_map.at(reshape_m).get_shape();
+            if (reshaped_shape != ov::Shape{weights_shape[0], weights_shape[1] * weights_shape[2]})
+                return false;
+        }
+
+        // the decompression parameters are set per output channel or per group of each output channel
+        const auto params_shape = with_reshape ? ov::Shape{weights_shape[0], weights_shape[1], 1}
+                                               : ov::Shape{weights_shape[0], 1};
+        auto is_supported_param = [&](const ov::Output<ov::Node>& param) {
+            return param.get_shape() == params_shape &&
+                   one_of(param.get_element_type(), ov::element::f32, ov::element::f16);
+        };
+        if (!is_supported_param(pattern_map.at(mul_const_m)))
+            return false;
+        if (pattern_map.count(sub_const_m) && !is_supported_param(pattern_map.at(sub_const_m)))
+            return false;
+
+        enable_keep_const_precision(weights);
+        return false;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
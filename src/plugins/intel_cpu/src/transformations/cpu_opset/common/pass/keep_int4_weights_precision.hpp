@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * This transformation marks the u4/i4 weights of the decompressed MatMul with keep_const_precision, so ConvertPrecision
+ * doesn't widen them to 8 bits and the FullyConnected node reads the 4-bit values as they are stored in the model.
+ * Only the weights the FullyConnected node decompresses by itself are marked: [OC, IC] or group-wise [OC, G, GS] weights
+ * of the MatMul with transpose_b and f32/bf16 activations, scaled (and shifted) by [OC, 1] or [OC, G, 1] constants.
+ * The other 4-bit weights are widened to 8 bits and decompressed as usual.
+ *
+ *           Weights(u4/i4)
+ *              |
+ *           Convert    Subtract_const
+ *              |      /
+ *          Subtract(opt)
+ *              |      Multiply_const
+ *              |     /
+ *           Multiply
+ *              |
+ *           Reshape(opt)
+ *              |
+ *     Data     |
+ *        \     /
+ *         MatMul
+ */
+class KeepInt4WeightsPrecision: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("KeepInt4WeightsPrecision", "0");
+    KeepInt4WeightsPrecision();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,210 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa_fusion.hpp"
+#include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/core/validation_util.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include "transformations/itt.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace {
+
+bool get_scalar(const ov::Output<ov::Node>& output, float& value) {
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    const auto constant = ov::get_constant_from_source(output);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    if (!constant || ov::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+bool has_single_consumer(const ov::Output<ov::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+// strips the multiplication or the division of the output by a scalar accumulating it in the scale
+ov::Output<ov::Node> strip_scale(const ov::Output<ov::Node>& output, float& scale, ov::NodeVector& fused) {
+    const auto node = output.get_node_shared_ptr();
+    float value = 0.f;
+    if (ov::is_type<ov::opset1::Multiply>(node)) {
+        for (size_t i = 0; i < 2; i++) {
+            if (get_scalar(node->input_value(1 - i), value) &&
+                node->get_output_partial_shape(0).compatible(node->get_input_partial_shape(i))) {
+                scale *= value;
+                fused.push_back(node);
+                return node->input_value(i);
+            }
+        }
+    } else if (ov::is_type<ov::opset1::Divide>(node)) {
+        if (get_scalar(node->input_value(1), value) && value != 0.f &&
+            node->get_output_partial_shape(0).compatible(node->get_input_partial_shape(0))) {
+            scale /= value;
+            fused.push_back(node);
+            return node->input_value(0);
+        }
+    }
+    return output;
+}
+
+bool is_scores(const ov::Output<ov::Node>& output) {
+    float scale = 1.f;
+    ov::NodeVector fused;
+    return ov::is_type<ov::opset1::MatMul>(strip_scale(output, scale, fused).get_node());
+}
+
+bool is_last_dims_transpose(const std::shared_ptr<ov::Node>& node, const size_t rank) {
+    if (!ov::is_type<ov::opset1::Transpose>(node))
+        return false;
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    const auto order = ov::get_constant_from_source(node->input_value(1));
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    if (!order)
+        return false;
+    const auto values = order->cast_vector<int64_t>();
+    if (values.size() != rank)
+        return false;
+    for (size_t i = 0; i < rank - 2; i++) {
+        if (values[i] != static_cast<int64_t>(i))
+            return false;
+    }
+    return values[rank - 2] == static_cast<int64_t>(rank - 1) && values[rank - 1] == static_cast<int64_t>(rank - 2);
+}
+
+// Range(start, ..., 1) unsqueezed at the axis
+bool is_unsqueezed_range(const ov::Output<ov::Node>& output, const int64_t start, const int64_t axis) {
+    const auto unsqueeze = ov::as_type_ptr<ov::opset1::Unsqueeze>(output.get_node_shared_ptr());
+    float value = 0.f;
+    if (!unsqueeze || !get_scalar(unsqueeze->input_value(1), value) || value != axis)
+        return false;
+    const auto range = unsqueeze->get_input_node_shared_ptr(0);
+    if (!ov::is_type<ov::opset1::Range>(range) && !ov::is_type<ov::opset4::Range>(range))
+        return false;
+    return get_scalar(range->input_value(0), value) && value == start &&
+           get_scalar(range->input_value(2), value) && value == 1.f;
+}
+
+// the causal mask of the PyTorch frontend masking out the keys j >= i + 1 for the query i:
+// Select(GreaterEqual(Unsqueeze(Range(0, S, 1), 0), Unsqueeze(Range(1, L + 1, 1), 1)), -inf, 0)
+bool is_causal_mask(const ov::Output<ov::Node>& output) {
+    const auto select = ov::as_type_ptr<ov::opset1::Select>(output.get_node_shared_ptr());
+    if (!select)
+        return false;
+    const auto greater_equal = ov::as_type_ptr<ov::opset1::GreaterEqual>(select->get_input_node_shared_ptr(0));
+    if (!greater_equal || !is_unsqueezed_range(greater_equal->input_value(0), 0, 0) ||
+        !is_unsqueezed_range(greater_equal->input_value(1), 1, 1))
+        return false;
+
+    float value = 0.f;
+    auto masked = select->input_value(1);
+    if (ov::is_type<ov::opset1::Broadcast>(masked.get_node()) || ov::is_type<ov::opset4::Broadcast>(masked.get_node()))
+        masked = masked.get_node()->input_value(0);
+    if (!get_scalar(masked, value) || value != -std::numeric_limits<float>::infinity())
+        return false;
+    return get_scalar(select->input_value(2), value) && value == 0.f;
+}
+
+}   // namespace
+
+ov::intel_cpu::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    MATCHER_SCOPE(ScaledDotProductAttentionFusion);
+    auto data_match = [](ov::Output<ov::Node> output) -> bool {
+        return has_static_rank()(output) && output.get_partial_shape().size() >= 3 &&
+               type_matches_any({ov::element::f32, ov::element::bf16})(output);
+    };
+    auto softmax_m = wrap_type<ov::opset1::Softmax, ov::opset8::Softmax>({any_input()}, consumers_count(1));
+    auto value_m = any_input(data_match);
+    auto matmul_m = wrap_type<ov::opset1::MatMul>({softmax_m, value_m}, data_match);
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul = ov::as_type_ptr<ov::opset1::MatMul>(m.get_match_root());
+        const auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        const auto value = pattern_map.at(value_m);
+        if (!matmul || matmul->get_transpose_a() || matmul->get_transpose_b())
+            return false;
+
+        const auto rank = value.get_partial_shape().size();
+        int64_t axis = 0;
+        if (const auto softmax_v1 = ov::as_type_ptr<ov::opset1::Softmax>(softmax)) {
+            axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else {
+            axis = ov::as_type_ptr<ov::opset8::Softmax>(softmax)->get_axis();
+            axis = axis < 0 ? axis + static_cast<int64_t>(rank) : axis;
+        }
+        if (axis != static_cast<int64_t>(rank) - 1)
+            return false;
+
+        ov::NodeVector fused{matmul, softmax};
+        ov::Output<ov::Node> scores = softmax->input_value(0);
+        if (!has_single_consumer(scores))
+            return false;
+        ov::Output<ov::Node> mask;
+        bool causal = false;
+        if (const auto add = ov::as_type_ptr<ov::opset1::Add>(scores.get_node_shared_ptr())) {
+            for (size_t i = 0; i < 2 && !mask.get_node(); i++) {
+                if (is_scores(add->input_value(i)) &&
+                    add->get_output_partial_shape(0).compatible(add->get_input_partial_shape(i))) {
+                    scores = add->input_value(i);
+                    mask = add->input_value(1 - i);
+                }
+            }
+            if (!mask.get_node() || !has_single_consumer(scores))
+                return false;
+            fused.push_back(add);
+            if (is_causal_mask(mask)) {
+                causal = true;
+                mask = {};
+            } else if (mask.get_partial_shape().rank().is_dynamic() || mask.get_partial_shape().size() > rank) {
+                return false;
+            }
+        }
+
+        float scale = 1.f;
+        scores = strip_scale(scores, scale, fused);
+        const auto qk = ov::as_type_ptr<ov::opset1::MatMul>(scores.get_node_shared_ptr());
+        if (!qk || qk->get_transpose_a() || !has_single_consumer(scores))
+            return false;
+        fused.push_back(qk);
+
+        auto query = qk->input_value(0);
+        auto key = qk->input_value(1);
+        if (!qk->get_transpose_b()) {
+            if (!is_last_dims_transpose(key.get_node_shared_ptr(), rank) || !has_single_consumer(key))
+                return false;
+            fused.push_back(key.get_node_shared_ptr());
+            key = key.get_node()->input_value(0);
+        }
+        if (has_single_consumer(query))
+            query = strip_scale(query, scale, fused);
+
+        if (!data_match(query) || !data_match(key) || query.get_partial_shape().size() != rank ||
+            key.get_partial_shape().size() != rank || query.get_element_type() != value.get_element_type() ||
+            key.get_element_type() != value.get_element_type() ||
+            (mask.get_node() && mask.get_element_type() != value.get_element_type()))
+            return false;
+
+        ov::OutputVector inputs{query, key, value};
+        if (mask.get_node())
+            inputs.push_back(mask);
+        const auto sdpa = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(inputs, scale, causal);
+        sdpa->set_friendly_name(matmul->get_friendly_name());
+        ov::copy_runtime_info(fused, sdpa);
+        ov::replace_node(matmul, sdpa);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
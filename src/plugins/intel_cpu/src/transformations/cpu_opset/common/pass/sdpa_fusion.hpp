@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Fuses the scaled dot product attention subgraph softmax(scale * Q * K^T + mask) * V into
+ *     ScaledDotProductAttentionNode. The scale is a scalar multiplier of the scores or of the queries, the mask is
+ *     optional, the causal mask built by the PyTorch frontend is replaced by the causal attribute.
+ *
+ *      Q    K
+ *      |    |
+ *      | Transpose                                  Q   K   V   [mask]
+ *       \  /                                         \  |  /    /
+ *      MatMul   [scale]                              ScaledDotProductAttentionNode
+ *         \    /                          =>                  |
+ *         Multiply    [mask]
+ *             \      /
+ *               Add
+ *                |
+ *             Softmax   V
+ *                 \    /
+ *                 MatMul
+ */
+class ScaledDotProductAttentionFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ScaledDotProductAttentionFusion", "0");
+    ScaledDotProductAttentionFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
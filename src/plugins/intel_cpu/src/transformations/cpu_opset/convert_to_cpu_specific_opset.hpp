@@ -21,6 +21,7 @@
 #include "common/pass/rnn_sequences_optimization.hpp"
 #include "transformations/common_optimizations/reshape_sequence_fusion.hpp"
 #include "common/pass/ngram_fusion.hpp"
+#include "common/pass/sdpa_fusion.hpp"
 #include "transformations/defs.hpp"
 
 #include "itt.hpp"
@@ -33,6 +34,7 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
 
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    CPU_REGISTER_PASS_COMMON(manager, ScaledDotProductAttentionFusion);
     CPU_REGISTER_PASS_COMMON(manager, ConvertMatMulToFC);
     CPU_REGISTER_PASS_X64(manager, MoveFCReshapeToWeights);
     CPU_REGISTER_PASS_X64(manager, ov::pass::Validate);
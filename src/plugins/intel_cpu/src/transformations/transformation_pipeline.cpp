@@ -106,6 +106,7 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/keep_int4_weights_precision.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -208,8 +209,10 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
     } else {
         // MarkDequantizationSubgraph is used even in non-LPT pipeline on X64 platforms
-        // in order to keep compressed u8 MatMul weights with decompression operations as is
-        CPU_REGISTER_PASS_X64(manager, ov::pass::MarkDequantizationSubgraph, ov::element::TypeVector{ov::element::u8}, true);
+        // in order to keep compressed u8 and 4-bit MatMul weights and u8/i8 and 4-bit embedding tables with decompression
+        // operations as is
+        CPU_REGISTER_PASS_X64(manager, ov::pass::MarkDequantizationSubgraph,
+                              ov::element::TypeVector{ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4}, true);
         CPU_SET_CALLBACK_X64(manager, [](const_node_ptr &node) -> bool {
             auto get_single_consumer = [](const_node_ptr &node) -> std::shared_ptr<ov::Node> {
                 const auto consumers = node->get_output_target_inputs(0);
@@ -218,20 +221,40 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
                 return consumers.begin()->get_node()->shared_from_this();
             };
 
+            // the precision of the compressed constant: Convert -> (Subtract) -> Multiply
+            auto get_compressed_precision = [](const_node_ptr &multiply) -> ov::element::Type {
+                auto parent = multiply->get_input_node_ptr(0);
+                if (ov::is_type<ov::opset1::Subtract>(parent))
+                    parent = parent->get_input_node_ptr(0);
+                return ov::is_type<ov::opset1::Convert>(parent) ? parent->get_input_element_type(0) : ov::element::undefined;
+            };
+
             auto consumer = get_single_consumer(node);
             if (!consumer)
                 return true;
 
+            // the FullyConnected weights decompression doesn't support i8, the embedding tables are decompressed by the nodes
+            const bool embeddingOnly = get_compressed_precision(node) == ov::element::i8;
             if (ov::is_type<ov::opset1::MatMul>(consumer)) {
-                return false;
-            } else if (ov::is_type<ov::opset1::Transpose>(consumer)) {
+                return embeddingOnly;
+            } else if (ov::is_type<ov::opset3::EmbeddingBagOffsetsSum>(consumer) ||
+                       ov::is_type<ov::opset3::EmbeddingBagPackedSum>(consumer) ||
+                       ov::is_type<ov::opset3::EmbeddingSegmentsSum>(consumer)) {
+                // the table is decompressed row by row inside the embedding nodes
+                if (consumer->get_input_node_ptr(0) == node.get())
+                    return false;
+            } else if (ov::is_type<ov::opset1::Transpose>(consumer) || ov::is_type<ov::opset1::Reshape>(consumer)) {
+                // Reshape merges the groups of the group-wise decompressed weights
                 consumer = get_single_consumer(consumer);
                 if (consumer != nullptr && ov::is_type<ov::opset1::MatMul>(consumer)) {
-                    return false;
+                    return embeddingOnly;
                 }
             }
             return true;
         }, ov::pass::MarkDequantizationSubgraph);
+        // the FullyConnected node decompresses the 4-bit weights by itself, so they aren't widened to 8 bits
+        if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2))
+            CPU_REGISTER_PASS_X64(manager, KeepInt4WeightsPrecision);
     }
 
     auto get_convert_precisions = []() {
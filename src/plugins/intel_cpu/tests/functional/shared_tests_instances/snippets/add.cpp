@@ -73,6 +73,11 @@ std::vector<std::vector<InputShape>> inShapesAddPair {
          {{{1, 1}, {128, 128}, {1, 10}, {1, 33}}, {{1, 128, 1, 1}, {1, 128, 1, 9}, {1, 128, 1, 17}, {1, 128, 1, 29}, {1, 128, 1, 30}, {1, 128, 1, 1}}}},
         {{{1, -1, 1, {1, 32}}, {{1, 16, 1, 32}, {1, 16, 1, 32}, {1, 16, 1, 32}, {1, 16, 1, 32}}},
          {{1, -1, 1, {1, 32}}, {{1, 16, 1, 32}, {1, 16, 1, 32}, {1, 16, 1, 32}, {1, 16, 1, 32}}}},
+        // DS with the static long innermost dimension: the kernel is shared by the shapes
+        {{{-1, -1, 768}, {{1, 10, 768}, {2, 7, 768}, {1, 1, 768}, {2, 7, 768}}},
+         {{-1, -1, 768}, {{1, 10, 768}, {2, 1, 768}, {1, 1, 768}, {2, 7, 768}}}},
+        {{{-1, -1, 768}, {{1, 10, 768}, {2, 7, 768}, {1, 1, 768}, {2, 7, 768}}},
+         {{-1, 1, 1}, {{1, 1, 1}, {2, 1, 1}, {1, 1, 1}, {2, 1, 1}}}},
 };
 INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise, AddPair,
                          ::testing::Combine(
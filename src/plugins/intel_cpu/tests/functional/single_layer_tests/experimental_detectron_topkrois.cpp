@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <openvino/op/experimental_detectron_topkrois.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+using TopKROIsTiesParams = std::tuple<size_t,     // input rois
+                                      int64_t>;   // max rois
+
+// The probabilities take a few distinct values, so most of the ROIs are tied. The node breaks the ties by the index
+// of the ROI, the output is compared with the stable order of the ROIs by the probabilities. The long inputs are
+// pre-selected by the threads.
+class TopKROIsTiesCPUTest : public testing::WithParamInterface<TopKROIsTiesParams>, public testing::Test {};
+
+TEST_P(TopKROIsTiesCPUTest, TiesKeepRoisOrder) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    size_t roisNum;
+    int64_t maxRois;
+    std::tie(roisNum, maxRois) = GetParam();
+
+    auto rois = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{roisNum, 4});
+    auto probs = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{roisNum});
+    auto topK = std::make_shared<ov::op::v6::ExperimentalDetectronTopKROIs>(rois, probs, maxRois);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{topK}, ov::ParameterVector{rois, probs});
+
+    ov::Tensor roisTensor{ov::element::f32, rois->get_shape()};
+    ov::Tensor probsTensor{ov::element::f32, probs->get_shape()};
+    auto roisData = roisTensor.data<float>();
+    auto probsData = probsTensor.data<float>();
+    for (size_t i = 0; i < roisNum; i++) {
+        // the ROI is identified by its index
+        std::fill_n(roisData + 4 * i, 4, static_cast<float>(i));
+        probsData[i] = static_cast<float>(i * 7919 % 5) * 0.25f;
+    }
+
+    ov::Core core;
+    auto request = core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request();
+    request.set_tensor(rois, roisTensor);
+    request.set_tensor(probs, probsTensor);
+    request.infer();
+
+    std::vector<size_t> expected(roisNum);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) {
+        return probsData[a] > probsData[b];
+    });
+    const auto output = request.get_output_tensor(0);
+    const auto outputData = output.data<const float>();
+    const size_t topNum = std::min(roisNum, static_cast<size_t>(maxRois));
+    ASSERT_EQ(output.get_shape(), (ov::Shape{topNum, 4}));
+    for (size_t i = 0; i < topNum; i++)
+        ASSERT_EQ(outputData[4 * i], static_cast<float>(expected[i])) << "at the output ROI " << i;
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopKROIsTies, TopKROIsTiesCPUTest,
+                         ::testing::Values(TopKROIsTiesParams{100, 10},
+                                           TopKROIsTiesParams{3000, 1000},
+                                           TopKROIsTiesParams{50000, 100},
+                                           TopKROIsTiesParams{50000, 2000}),
+                         [](const testing::TestParamInfo<TopKROIsTiesParams>& info) {
+                             return "rois_" + std::to_string(std::get<0>(info.param)) +
+                                    "_maxRois_" + std::to_string(std::get<1>(info.param));
+                         });
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <openvino/op/matrix_nms.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+// The IoU of a box with a non-positive area (zero width or inverted) is zero, so the degenerate boxes neither decay
+// the scores of the other boxes nor are decayed by them, while the duplicate of the top box is suppressed.
+TEST(MatrixNmsCPUTest, DegenerateBoxesAreNotDecayed) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const std::vector<float> boxesValues = {
+        0.0f, 0.0f, 1.0f, 1.0f,    // the top box
+        0.5f, 0.0f, 0.5f, 1.0f,    // zero width inside the top box
+        0.6f, 0.2f, 0.4f, 0.8f,    // inverted inside the top box
+        0.0f, 0.0f, 1.0f, 1.0f,    // the duplicate of the top box
+    };
+    const std::vector<float> scoresValues = {0.9f, 0.8f, 0.7f, 0.6f};
+    auto boxes = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 4});
+    auto scores = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 1, 4});
+
+    ov::op::v8::MatrixNms::Attributes attrs;
+    attrs.sort_result_type = ov::op::v8::MatrixNms::SortResultType::SCORE;
+    attrs.output_type = ov::element::i32;
+    attrs.decay_function = ov::op::v8::MatrixNms::DecayFunction::LINEAR;
+    attrs.post_threshold = 0.1f;
+    attrs.background_class = -1;
+    attrs.normalized = true;
+    auto nms = std::make_shared<ov::op::v8::MatrixNms>(boxes, scores, attrs);
+    auto model = std::make_shared<ov::Model>(nms->outputs(), ov::ParameterVector{boxes, scores});
+
+    ov::Core core;
+    auto request = core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request();
+    request.set_tensor(boxes, ov::Tensor{ov::element::f32, boxes->get_shape(), const_cast<float*>(boxesValues.data())});
+    request.set_tensor(scores, ov::Tensor{ov::element::f32, scores->get_shape(), const_cast<float*>(scoresValues.data())});
+    request.infer();
+
+    // [class, score, x1, y1, x2, y2] of the selected boxes
+    const auto selected = request.get_output_tensor(0);
+    const auto indices = request.get_output_tensor(1);
+    const auto valid = request.get_output_tensor(2);
+    ASSERT_EQ(valid.data<const int32_t>()[0], 3);
+    const auto selectedData = selected.data<const float>();
+    const auto indicesData = indices.data<const int32_t>();
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(indicesData[i], static_cast<int32_t>(i));
+        EXPECT_NEAR(selectedData[6 * i + 1], scoresValues[i], 1e-6f);
+        for (size_t j = 0; j < 4; j++)
+            EXPECT_EQ(selectedData[6 * i + 2 + j], boxesValues[4 * i + j]);
+    }
+}
+
+}  // namespace CPULayerTestsDefinitions
@@ -2,8 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <iostream>
+
 #include "test_utils/cpu_test_utils.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include "openvino/runtime/core.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
 
@@ -174,4 +178,202 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, ScatterElementsUpdateLayerCPUTes
         ::testing::ValuesIn(inputPrecisions),
         ::testing::ValuesIn(constantPrecisions)),
     ScatterElementsUpdateLayerCPUTest::getTestCaseName);
+
+using Reduction = ov::op::v12::ScatterElementsUpdate::Reduction;
+
+using scatterUpdateReductionParams = std::tuple<
+    ScatterElementsUpdateShapes,
+    std::int64_t,       // axis
+    Reduction,
+    bool,               // use init value
+    bool,               // the same index along the innermost dimension
+    ElementType>;       // input precision
+
+class ScatterElementsUpdateReductionLayerCPUTest : public testing::WithParamInterface<scatterUpdateReductionParams>,
+                                                   public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<scatterUpdateReductionParams> obj) {
+        ScatterElementsUpdateShapes inputShapes;
+        std::int64_t axis;
+        Reduction reduction;
+        bool useInitVal;
+        bool uniformRows;
+        ElementType inputPrecision;
+        std::tie(inputShapes, axis, reduction, useInitVal, uniformRows, inputPrecision) = obj.param;
+
+        std::ostringstream result;
+        result << inputPrecision << "_IS=";
+        for (const auto& shape : inputShapes) {
+            result << ov::test::utils::partialShape2str({ shape.first }) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            result << "(";
+            for (const auto& targetShape : shape.second) {
+                result << ov::test::utils::vec2str(targetShape) << "_";
+            }
+            result << ")_";
+        }
+        result << "axis=" << axis << "_reduction=" << reduction << "_use_init_val=" << useInitVal
+               << "_uniform_rows=" << uniformRows;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        std::int64_t axis;
+        bool uniformRows;
+        std::tie(std::ignore, axis, std::ignore, std::ignore, uniformRows, std::ignore) = this->GetParam();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            const auto& inputPrecision = funcInput.get_element_type();
+            const auto& targetShape = targetInputStaticShapes[i];
+            ov::Tensor tensor;
+            if (i == 1) {
+                // the indices repeat to reduce several updates into the same elements, the negative ones included
+                const auto& dataShape = targetInputStaticShapes[0];
+                const auto axisDim = static_cast<std::int32_t>(dataShape[axis < 0 ? axis + dataShape.size() : axis]);
+                const size_t rowSize = targetShape.back();
+                tensor = ov::Tensor{ inputPrecision, targetShape };
+                auto data = tensor.data<std::int32_t>();
+                for (size_t j = 0; j < tensor.get_size(); ++j) {
+                    const size_t pos = uniformRows ? j / rowSize : j;
+                    data[j] = static_cast<std::int32_t>(pos * 7919 % (2 * axisDim)) - axisDim;
+                }
+            } else if (inputPrecision.is_real()) {
+                tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape, 10, 1, 1000);
+            } else {
+                tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape, 10, -5);
+            }
+            inputs.insert({ funcInput.get_node_shared_ptr(), tensor });
+        }
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ScatterElementsUpdateShapes inputShapes;
+        std::int64_t axis;
+        Reduction reduction;
+        bool useInitVal;
+        ElementType inputPrecision;
+        std::tie(inputShapes, axis, reduction, useInitVal, std::ignore, inputPrecision) = this->GetParam();
+
+        init_input_shapes(inputShapes);
+        selectedType = makeSelectedTypeStr("unknown", inputPrecision);
+
+        auto dataParam = std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputDynamicShapes[0]);
+        auto indicesParam = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, inputDynamicShapes[1]);
+        auto updatesParam = std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputDynamicShapes[2]);
+        auto axisNode = ov::op::v0::Constant::create(ElementType::i32, {}, { axis });
+        auto scatter = std::make_shared<ov::op::v12::ScatterElementsUpdate>(dataParam, indicesParam, updatesParam, axisNode,
+                                                                            reduction, useInitVal);
+
+        ngraph::ParameterVector allParams{ dataParam, indicesParam, updatesParam };
+        function = makeNgraphFunction(inputPrecision, allParams, scatter, "ScatterElementsUpdateReductionLayerCPUTest");
+    }
+};
+
+TEST_P(ScatterElementsUpdateReductionLayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "ScatterUpdate");
+}
+
+const std::vector<ScatterElementsUpdateShapes> reductionShapes = {
+    {{{-1, -1, -1}, {{10, 12, 15}, {8, 9, 10}}},
+     {{-1, -1, -1}, {{4, 12, 15}, {8, 2, 7}}},
+     {{-1, -1, -1}, {{4, 12, 15}, {8, 2, 7}}}},
+    {{{}, {{7, 130}}},
+     {{}, {{5, 100}}},
+     {{}, {{5, 100}}}},
+};
+
+const std::vector<Reduction> reductions = {
+    Reduction::SUM,
+    Reduction::PROD,
+    Reduction::MIN,
+    Reduction::MAX,
+    Reduction::MEAN,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Reduction, ScatterElementsUpdateReductionLayerCPUTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(reductionShapes),
+        ::testing::Values(-1, 0, 1),
+        ::testing::ValuesIn(reductions),
+        ::testing::Values(true, false),
+        ::testing::Values(true, false),
+        ::testing::ValuesIn(inputPrecisions)),
+    ScatterElementsUpdateReductionLayerCPUTest::getTestCaseName);
+
+// the message passing of the graph networks: the features of the edges are reduced into the nodes
+const std::vector<ScatterElementsUpdateShapes> messagePassingShapes = {
+    {{{-1, 64}, {{2000, 64}, {500, 64}}},
+     {{-1, 64}, {{10000, 64}, {3000, 64}}},
+     {{-1, 64}, {{10000, 64}, {3000, 64}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MessagePassing, ScatterElementsUpdateReductionLayerCPUTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(messagePassingShapes),
+        ::testing::Values(0),
+        ::testing::Values(Reduction::SUM, Reduction::MEAN, Reduction::MAX),
+        ::testing::Values(true, false),
+        ::testing::Values(true),
+        ::testing::Values(ElementType::f32)),
+    ScatterElementsUpdateReductionLayerCPUTest::getTestCaseName);
+
+using MessagePassingSize = std::tuple<size_t,    // graph nodes
+                                      size_t>;   // graph edges
+
+// Measures the sum reduction of the edge features into the graph nodes at the sizes of the graph network layers
+class ScatterElementsUpdateBenchmarkCPUTest : public testing::WithParamInterface<MessagePassingSize>, public testing::Test {};
+
+TEST_P(ScatterElementsUpdateBenchmarkCPUTest, MessagePassing) {
+    constexpr size_t features = 64;
+    constexpr size_t iterations = 20;
+    size_t nodes, edges;
+    std::tie(nodes, edges) = GetParam();
+
+    auto dataParam = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, ov::Shape{nodes, features});
+    auto indicesParam = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::Shape{edges, features});
+    auto updatesParam = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, ov::Shape{edges, features});
+    auto axisNode = ov::op::v0::Constant::create(ElementType::i32, {}, { 0 });
+    auto scatter = std::make_shared<ov::op::v12::ScatterElementsUpdate>(dataParam, indicesParam, updatesParam, axisNode,
+                                                                        Reduction::SUM, true);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(scatter)},
+                                             ov::ParameterVector{dataParam, indicesParam, updatesParam});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+    request.set_tensor(dataParam, ov::test::utils::create_and_fill_tensor(ElementType::f32, dataParam->get_shape(), 10, 1, 1000));
+    request.set_tensor(updatesParam, ov::test::utils::create_and_fill_tensor(ElementType::f32, updatesParam->get_shape(), 10, 1, 1000));
+    // every edge scatters its whole feature row to the destination node
+    ov::Tensor indices{ElementType::i32, indicesParam->get_shape()};
+    auto indicesData = indices.data<std::int32_t>();
+    for (size_t e = 0; e < edges; e++)
+        std::fill_n(indicesData + e * features, features, static_cast<std::int32_t>(e * 7919 % nodes));
+    request.set_tensor(indicesParam, indices);
+
+    // warm up
+    request.infer();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+        request.infer();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double latency = elapsed.count() / iterations;
+    std::cout << "[ LATENCY ] nodes: " << nodes << ", edges: " << edges << ", features: " << features << ", "
+              << latency << " ms, " << edges / latency / 1e3 << " Medges/s" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MessagePassing, ScatterElementsUpdateBenchmarkCPUTest,
+    ::testing::Values(MessagePassingSize{2708, 10556},        // Cora
+                      MessagePassingSize{19717, 88648},       // PubMed
+                      MessagePassingSize{50000, 250000}),     // the indices and the updates take 128 MB
+    [](const testing::TestParamInfo<MessagePassingSize>& info) {
+        return "nodes_" + std::to_string(std::get<0>(info.param)) + "_edges_" + std::to_string(std::get<1>(info.param));
+    });
 } // namespace CPULayerTestsDefinitions
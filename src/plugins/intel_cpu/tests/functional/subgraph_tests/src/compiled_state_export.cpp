@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The exported model blob holds the compiled state of the graph after the IR: the selected primitive descriptors and
+// the reordered weights. The imported model must produce the same outputs and select the same primitives, and
+// the blobs without the section (exported before it was added) or with the section produced on another CPU must
+// still be imported, the section is ignored then.
+
+#include <ngraph_functions/builders.hpp>
+#include <openvino/opsets/opset9.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/core.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+class CompiledStateExportCPUTest : public testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::opset9::Parameter>(precision, ov::Shape{1, 16, 8, 8});
+        // the weights of the convolution are reordered to the blocked layout of the primitive
+        auto convWeights = ngraph::builder::makeConstant<float>(precision, {32, 16, 3, 3}, {}, true);
+        auto conv = std::make_shared<ov::opset9::Convolution>(param, convWeights, ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+        auto relu = std::make_shared<ov::opset9::Relu>(conv);
+        auto shape = ov::opset9::Constant::create(ov::element::i64, {2}, {32, 64});
+        auto reshape = std::make_shared<ov::opset9::Reshape>(relu, shape, false);
+        auto fcWeights = ngraph::builder::makeConstant<float>(precision, {64, 48}, {}, true);
+        auto matMul = std::make_shared<ov::opset9::MatMul>(reshape, fcWeights);
+        model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset9::Result>(matMul)},
+                                            ov::ParameterVector{param}, "CompiledStateExport");
+
+        input = ov::Tensor(precision, ov::Shape{1, 16, 8, 8});
+        auto* data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>(i % 13) / 13.f - 0.5f;
+
+        compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+        std::stringstream stream;
+        compiledModel.export_model(stream);
+        blob = stream.str();
+        sectionPos = blob.find(std::string(magic, sizeof(magic)));
+        ASSERT_NE(sectionPos, std::string::npos);
+    }
+
+    std::vector<float> infer(ov::CompiledModel& compiled) {
+        auto request = compiled.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto output = request.get_output_tensor();
+        const auto* data = output.data<const float>();
+        return std::vector<float>(data, data + output.get_size());
+    }
+
+    ov::CompiledModel import(const std::string& data) {
+        std::stringstream stream(data);
+        return core.import_model(stream, ov::test::utils::DEVICE_CPU);
+    }
+
+    // the implementation type, the precision and the output layouts of each node of the runtime model
+    static std::map<std::string, std::string> primitives(const ov::CompiledModel& compiled) {
+        auto rtValue = [](const ov::RTMap& rtInfo, const std::string& key) {
+            auto it = rtInfo.find(key);
+            return it != rtInfo.end() ? it->second.as<std::string>() : std::string();
+        };
+        std::map<std::string, std::string> result;
+        for (const auto& node : compiled.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            result[node->get_friendly_name()] = rtValue(rtInfo, ExecGraphInfoSerialization::IMPL_TYPE) + "_" +
+                                                rtValue(rtInfo, ExecGraphInfoSerialization::RUNTIME_PRECISION) + "_" +
+                                                rtValue(rtInfo, ExecGraphInfoSerialization::OUTPUT_LAYOUTS);
+        }
+        return result;
+    }
+
+    void checkImported(ov::CompiledModel& imported) {
+        EXPECT_EQ(infer(imported), infer(compiledModel));
+        EXPECT_EQ(primitives(imported), primitives(compiledModel));
+    }
+
+    // the section starts with the magic followed by its size, the format version and the instruction set mask
+    static constexpr char magic[8] = {'C', 'P', 'U', 'G', 'R', 'A', 'P', 'H'};
+    static constexpr size_t isaMaskOffset = sizeof(magic) + sizeof(uint64_t) + sizeof(uint32_t);
+
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+    ov::Tensor input;
+    std::string blob;
+    size_t sectionPos = 0;
+};
+
+constexpr char CompiledStateExportCPUTest::magic[8];
+constexpr size_t CompiledStateExportCPUTest::isaMaskOffset;
+
+TEST_F(CompiledStateExportCPUTest, ExportImportRoundTrip) {
+    auto imported = import(blob);
+    checkImported(imported);
+}
+
+TEST_F(CompiledStateExportCPUTest, BlobWithoutCompiledState) {
+    auto imported = import(blob.substr(0, sectionPos));
+    checkImported(imported);
+}
+
+TEST_F(CompiledStateExportCPUTest, CompiledStateOfAnotherIsaIsIgnored) {
+    auto data = blob;
+    ASSERT_GT(data.size(), sectionPos + isaMaskOffset + sizeof(uint64_t));
+    // the lowest bit of the mask is SSE4.1
+    data[sectionPos + isaMaskOffset] ^= 0x1;
+    // the section is skipped as a whole, the data which follows it in the stream is not touched
+    const std::string trailer = "trailer";
+    std::stringstream stream(data + trailer);
+    auto imported = core.import_model(stream, ov::test::utils::DEVICE_CPU);
+    checkImported(imported);
+    std::string rest;
+    stream >> rest;
+    EXPECT_EQ(rest, trailer);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/opsets/opset10.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *    Table(U8/I8/I4) [rows, dim]
+ *       |
+ *    Convert(F32)   Subtract_const(F32) [rows, 1]
+ *            \        /
+ *            Subtract(opt)   Multiply_const(F32) [rows, 1]
+ *                  \       /
+ *                   Multiply    Indices   Weights(F32)
+ *                        \        |        /
+ *                         EmbeddingBag*Sum
+ */
+enum class EmbeddingType {
+    OFFSETS_SUM,
+    PACKED_SUM,
+    SEGMENTS_SUM
+};
+
+using EmbeddingBagDecompressionParams = std::tuple<ov::Shape,               // table shape
+                                                   ov::test::ElementType,   // table precision
+                                                   EmbeddingType,
+                                                   bool>;                   // decompression subtract
+
+class EmbeddingBagDecompression : public testing::WithParamInterface<EmbeddingBagDecompressionParams>,
+                                  virtual public SubgraphBaseTest,
+                                  public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagDecompressionParams>& obj) {
+        ov::Shape tableShape;
+        ov::test::ElementType tablePrecision;
+        EmbeddingType type;
+        bool decompressionSub;
+        std::tie(tableShape, tablePrecision, type, decompressionSub) = obj.param;
+
+        std::ostringstream result;
+        result << "table_shape=" << ov::test::utils::vec2str(tableShape) << "_";
+        result << "table_precision=" << tablePrecision << "_";
+        result << "type=" << (type == EmbeddingType::OFFSETS_SUM ? "OffsetsSum" :
+                              type == EmbeddingType::PACKED_SUM ? "PackedSum" : "SegmentsSum") << "_";
+        result << "decompression_subtract=" << decompressionSub;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        ov::Shape tableShape;
+        ov::test::ElementType tablePrecision;
+        EmbeddingType type;
+        bool decompressionSub;
+        std::tie(tableShape, tablePrecision, type, decompressionSub) = GetParam();
+
+        const size_t rows = tableShape[0];
+        const ov::Shape paramsShape{rows, 1};
+        const bool isSigned = tablePrecision == ov::element::i8 || tablePrecision == ov::element::i4;
+        std::vector<int8_t> tableValues(ov::shape_size(tableShape));
+        for (size_t i = 0; i < tableValues.size(); i++)
+            tableValues[i] = static_cast<int8_t>(isSigned ? static_cast<int>(i * 7 % 16) - 8 : i * 7 % 16);
+        auto table = std::make_shared<ov::op::v0::Constant>(tablePrecision, tableShape, tableValues);
+        std::shared_ptr<ov::Node> mulParent = std::make_shared<ov::opset10::Convert>(table, ov::element::f32);
+        if (decompressionSub) {
+            auto shiftConst = ngraph::builder::makeConstant<float>(ov::element::f32, paramsShape, {}, true, 2.f, 0.f);
+            mulParent = std::make_shared<ov::opset10::Subtract>(mulParent, shiftConst);
+        }
+        auto scaleConst = ngraph::builder::makeConstant<float>(ov::element::f32, paramsShape, {}, true, 0.1f, 0.01f);
+        auto multiply = std::make_shared<ov::opset10::Multiply>(mulParent, scaleConst);
+
+        // the bags of different sizes, the empty one included, and the repeated indices
+        std::vector<int32_t> indicesValues(24);
+        for (size_t i = 0; i < indicesValues.size(); i++)
+            indicesValues[i] = static_cast<int32_t>(i * 13 % rows);
+
+        ov::ParameterVector params;
+        std::shared_ptr<ov::Node> embedding;
+        if (type == EmbeddingType::PACKED_SUM) {
+            const ov::Shape indicesShape{4, indicesValues.size() / 4};
+            params.push_back(std::make_shared<ov::opset10::Parameter>(ov::element::f32, indicesShape));
+            auto indices = ov::opset10::Constant::create(ov::element::i32, indicesShape, indicesValues);
+            embedding = std::make_shared<ov::opset3::EmbeddingBagPackedSum>(multiply, indices, params[0]);
+        } else {
+            const ov::Shape indicesShape{indicesValues.size()};
+            params.push_back(std::make_shared<ov::opset10::Parameter>(ov::element::f32, indicesShape));
+            auto indices = ov::opset10::Constant::create(ov::element::i32, indicesShape, indicesValues);
+            auto defaultIndex = ov::opset10::Constant::create(ov::element::i32, ov::Shape{}, {1});
+            if (type == EmbeddingType::OFFSETS_SUM) {
+                auto offsets = ov::opset10::Constant::create(ov::element::i32, ov::Shape{5}, {0, 2, 2, 17, 20});
+                embedding = std::make_shared<ov::opset3::EmbeddingBagOffsetsSum>(multiply, indices, offsets, defaultIndex, params[0]);
+            } else {
+                std::vector<int32_t> segmentIds(indicesValues.size());
+                for (size_t i = 0; i < segmentIds.size(); i++)
+                    segmentIds[i] = static_cast<int32_t>(i < 3 ? 0 : i < 20 ? 2 : 3);
+                auto segments = ov::opset10::Constant::create(ov::element::i32, indicesShape, segmentIds);
+                auto numSegments = ov::opset10::Constant::create(ov::element::i32, ov::Shape{}, {5});
+                embedding = std::make_shared<ov::opset3::EmbeddingSegmentsSum>(multiply, indices, segments, numSegments,
+                                                                               defaultIndex, params[0]);
+            }
+        }
+        init_input_shapes(static_shapes_to_test_representation({params[0]->get_shape()}));
+        function = makeNgraphFunction(ov::element::f32, params, embedding, "EmbeddingBagDecompression");
+    }
+
+    void checkResults() {
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    }
+};
+
+TEST_P(EmbeddingBagDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    checkResults();
+}
+
+namespace {
+
+// the rows wider and narrower than the vector registers with the tails
+const std::vector<ov::Shape> tableShapes = {
+    {50, 64},
+    {100, 37},
+    {31, 5},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDecompression, EmbeddingBagDecompression,
+                         ::testing::Combine(::testing::ValuesIn(tableShapes),
+                                            ::testing::Values(ov::element::u8, ov::element::i8, ov::element::i4),
+                                            ::testing::Values(EmbeddingType::OFFSETS_SUM,
+                                                              EmbeddingType::PACKED_SUM,
+                                                              EmbeddingType::SEGMENTS_SUM),
+                                            ::testing::Values(true, false)),
+                         EmbeddingBagDecompression::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
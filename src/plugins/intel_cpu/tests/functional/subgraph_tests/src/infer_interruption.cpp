@@ -0,0 +1,259 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// A canceled inference or an inference out of its latency budget is interrupted inside the long nodes (between the
+// iterations of a Loop body, at the chunk boundaries of MHA and of a Snippet) and leaves the request usable: the next
+// inference of the same request runs to completion with the correct results. The canceled inference fails with
+// INFER_CANCELLED, the inference out of its budget fails with its own error, so the two are told apart.
+
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exception.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+enum class InterruptedModel {
+    Loop,     // many iterations of a body graph
+    MHA,      // attention block, the parallel kernel is polled per (batch, head)
+    Snippet,  // long eltwise chain tokenized into a single Subgraph node
+};
+
+std::ostream& operator<<(std::ostream& os, InterruptedModel model) {
+    switch (model) {
+    case InterruptedModel::Loop:
+        return os << "Loop";
+    case InterruptedModel::MHA:
+        return os << "MHA";
+    case InterruptedModel::Snippet:
+        return os << "Snippet";
+    }
+    return os;
+}
+
+class InferInterruptionCPUTest : public testing::WithParamInterface<InterruptedModel>, public testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterruptedModel>& obj) {
+        std::ostringstream result;
+        result << "Model=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        switch (GetParam()) {
+        case InterruptedModel::Loop:
+            model = makeLoop();
+            break;
+        case InterruptedModel::MHA:
+            model = makeMHA();
+            // the attention pattern is executed by the MHA node instead of the tokenized Subgraph
+            config.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                           InferenceEngine::PluginConfigInternalParams::DISABLE});
+            break;
+        case InterruptedModel::Snippet:
+            model = makeEltwiseChain();
+            break;
+        }
+    }
+
+    static std::shared_ptr<ov::Model> makeLoop() {
+        const auto precision = ov::element::f32;
+        const ov::Shape shape{1, 64, 64, 64};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+
+        auto bodyParam = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(bodyParam, ngraph::builder::makeConstant<float>(precision, {1}, {0.5f}));
+        auto add = std::make_shared<ov::op::v1::Add>(mul, ngraph::builder::makeConstant<float>(precision, {1}, {1.f}));
+        auto bodyCondition = ngraph::builder::makeConstant<bool>(ov::element::boolean, {1}, {true});
+        auto bodyResult = std::make_shared<ov::op::v0::Result>(add);
+        auto conditionResult = std::make_shared<ov::op::v0::Result>(bodyCondition);
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{conditionResult, bodyResult}, ov::ParameterVector{bodyParam});
+
+        auto tripCount = ngraph::builder::makeConstant<int64_t>(ov::element::i64, {1}, {4096});
+        auto execCondition = ngraph::builder::makeConstant<bool>(ov::element::boolean, {1}, {true});
+        auto loop = std::make_shared<ov::op::v5::Loop>(tripCount, execCondition);
+        loop->set_function(body);
+        loop->set_special_body_ports({-1, 0});
+        loop->set_merged_input(bodyParam, param, bodyResult);
+        auto out = loop->get_iter_value(bodyResult, -1);
+
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(out)},
+                                           ov::ParameterVector{param}, "InterruptedLoop");
+    }
+
+    static std::shared_ptr<ov::Model> makeMHA() {
+        const auto precision = ov::element::f32;
+        // [batch, seq_len, heads, head_size]
+        const ov::Shape shape{1, 1024, 16, 64};
+        ov::ParameterVector params;
+        for (size_t i = 0; i < 3; i++)
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        auto mask = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 1, 1, shape[1]});
+        params.push_back(mask);
+
+        auto order = [](std::vector<int64_t> values) {
+            return ngraph::builder::makeConstant<int64_t>(ov::element::i64, {values.size()}, values);
+        };
+        auto query = std::make_shared<ov::op::v1::Transpose>(params[0], order({0, 2, 1, 3}));
+        auto key = std::make_shared<ov::op::v1::Transpose>(params[1], order({0, 2, 3, 1}));
+        auto value = std::make_shared<ov::op::v1::Transpose>(params[2], order({0, 2, 1, 3}));
+        auto scaledKey = std::make_shared<ov::op::v1::Multiply>(key, ngraph::builder::makeConstant<float>(precision, {1}, {0.125f}));
+        auto scores = std::make_shared<ov::op::v0::MatMul>(query, scaledKey);
+        auto masked = std::make_shared<ov::op::v1::Add>(scores, mask);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(masked, 3);
+        auto attention = std::make_shared<ov::op::v0::MatMul>(softmax, value);
+        auto out = std::make_shared<ov::op::v1::Transpose>(attention, order({0, 2, 1, 3}));
+
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(out)}, params,
+                                           "InterruptedMHA");
+    }
+
+    static std::shared_ptr<ov::Model> makeEltwiseChain() {
+        const auto precision = ov::element::f32;
+        const ov::Shape shape{1, 64, 256, 256};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        std::shared_ptr<ov::Node> node = param;
+        for (size_t i = 0; i < 4; i++) {
+            node = std::make_shared<ov::op::v1::Multiply>(node, ngraph::builder::makeConstant<float>(precision, {1}, {0.5f}));
+            node = std::make_shared<ov::op::v0::Sigmoid>(node);
+            node = std::make_shared<ov::op::v1::Add>(node, ngraph::builder::makeConstant<float>(precision, {1}, {0.25f}));
+        }
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(node)},
+                                           ov::ParameterVector{param}, "InterruptedSnippet");
+    }
+
+    void fillInputs(ov::InferRequest& request, const ov::CompiledModel& compiledModel) {
+        int seed = 1;
+        for (const auto& input : compiledModel.inputs()) {
+            request.set_tensor(input, ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape(),
+                                                                              10, -5, 1000, seed++));
+        }
+    }
+
+    void compareOutputs(ov::InferRequest& expected, ov::InferRequest& actual, const ov::CompiledModel& compiledModel) {
+        for (const auto& output : compiledModel.outputs())
+            ov::test::utils::compare(expected.get_tensor(output), actual.get_tensor(output), 1e-5, 1e-5);
+    }
+
+    template <typename F>
+    static void expectOverBudget(const F& infer) {
+        try {
+            infer();
+            FAIL() << "The inference is expected to exceed its latency budget";
+        } catch (const ov::Cancelled& ex) {
+            FAIL() << "The inference out of its budget is reported as canceled: " << ex.what();
+        } catch (const ov::Exception& ex) {
+            EXPECT_NE(std::string(ex.what()).find("latency budget"), std::string::npos) << ex.what();
+        }
+    }
+
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+    ov::AnyMap config;
+};
+
+TEST_P(InferInterruptionCPUTest, CancelInterruptsRunningInference) {
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+
+    auto reference = compiledModel.create_infer_request();
+    fillInputs(reference, compiledModel);
+    reference.infer();
+
+    auto request = compiledModel.create_infer_request();
+    fillInputs(request, compiledModel);
+    request.start_async();
+    request.cancel();
+    EXPECT_THROW(request.wait(), ov::Cancelled);
+
+    // the cancellation doesn't outlive the canceled inference
+    ASSERT_NO_THROW(request.infer());
+    compareOutputs(reference, request, compiledModel);
+    request.start_async();
+    ASSERT_NO_THROW(request.wait());
+    compareOutputs(reference, request, compiledModel);
+}
+
+TEST_P(InferInterruptionCPUTest, LatencyBudgetInterruptsInference) {
+    auto budgetConfig = config;
+    budgetConfig.insert(ov::intel_cpu::latency_budget(1));
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, budgetConfig);
+
+    auto request = compiledModel.create_infer_request();
+    fillInputs(request, compiledModel);
+    expectOverBudget([&] {
+        request.infer();
+    });
+    // every inference out of the budget is interrupted, the request stays usable
+    expectOverBudget([&] {
+        request.infer();
+    });
+    request.start_async();
+    expectOverBudget([&] {
+        request.wait();
+    });
+
+    // the same model fits a generous budget
+    auto generousConfig = config;
+    generousConfig.insert(ov::intel_cpu::latency_budget(600000000));
+    auto generousModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, generousConfig);
+    auto generousRequest = generousModel.create_infer_request();
+    fillInputs(generousRequest, generousModel);
+    ASSERT_NO_THROW(generousRequest.infer());
+}
+
+TEST_P(InferInterruptionCPUTest, LatencyBudgetOfRequest) {
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+
+    auto reference = compiledModel.create_infer_request();
+    fillInputs(reference, compiledModel);
+    reference.infer();
+
+    // the budget of the request, the other requests of the compiled model are not affected
+    auto request = compiledModel.create_infer_request();
+    fillInputs(request, compiledModel);
+    request.set_property(ov::intel_cpu::latency_budget(1));
+    expectOverBudget([&] {
+        request.infer();
+    });
+    request.start_async();
+    expectOverBudget([&] {
+        request.wait();
+    });
+    ASSERT_NO_THROW(reference.infer());
+
+    // the cancellation is still reported as such
+    request.start_async();
+    request.cancel();
+    EXPECT_THROW(request.wait(), ov::Cancelled);
+
+    // the budget of the request overrides the budget of the compiled model
+    request.set_property(ov::intel_cpu::latency_budget(0));
+    ASSERT_NO_THROW(request.infer());
+    compareOutputs(reference, request, compiledModel);
+
+    auto budgetConfig = config;
+    budgetConfig.insert(ov::intel_cpu::latency_budget(1));
+    auto budgetModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, budgetConfig);
+    auto generousRequest = budgetModel.create_infer_request();
+    fillInputs(generousRequest, budgetModel);
+    generousRequest.set_property(ov::intel_cpu::latency_budget(600000000));
+    ASSERT_NO_THROW(generousRequest.infer());
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_InferInterruption, InferInterruptionCPUTest,
+                         ::testing::Values(InterruptedModel::Loop, InterruptedModel::MHA, InterruptedModel::Snippet),
+                         InferInterruptionCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
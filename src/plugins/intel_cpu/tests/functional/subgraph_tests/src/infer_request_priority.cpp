@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The ov::hint::priority and ov::intel_cpu::latency_budget properties of an infer request are the scheduling parameters
+// of its runs: the queued runs of a higher priority are dispatched to the streams first, whatever the order they were
+// started in. The queues are reported per priority by the ov::intel_cpu::queue_statistics metric of the compiled model.
+
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include <ngraph_functions/builders.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exception.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+class InferRequestPriorityCPUTest : public testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        // the number of the iterations of the Loop is an input, so the same model runs long or short
+        const auto precision = ov::element::f32;
+        const ov::Shape shape{1, 64, 64};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto tripCount = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1});
+
+        auto bodyParam = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(bodyParam, ngraph::builder::makeConstant<float>(precision, {1}, {0.5f}));
+        auto add = std::make_shared<ov::op::v1::Add>(mul, ngraph::builder::makeConstant<float>(precision, {1}, {1.f}));
+        auto bodyCondition = ngraph::builder::makeConstant<bool>(ov::element::boolean, {1}, {true});
+        auto bodyResult = std::make_shared<ov::op::v0::Result>(add);
+        auto conditionResult = std::make_shared<ov::op::v0::Result>(bodyCondition);
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{conditionResult, bodyResult}, ov::ParameterVector{bodyParam});
+
+        auto execCondition = ngraph::builder::makeConstant<bool>(ov::element::boolean, {1}, {true});
+        auto loop = std::make_shared<ov::op::v5::Loop>(tripCount, execCondition);
+        loop->set_function(body);
+        loop->set_special_body_ports({-1, 0});
+        loop->set_merged_input(bodyParam, param, bodyResult);
+        auto out = loop->get_iter_value(bodyResult, -1);
+
+        model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(out)},
+                                            ov::ParameterVector{param, tripCount}, "PrioritizedLoop");
+        // a single stream, so the requests started while it is busy wait in the queue
+        compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, {ov::num_streams(1)});
+    }
+
+    ov::InferRequest createRequest(int64_t iterations) {
+        auto request = compiledModel.create_infer_request();
+        auto input = request.get_input_tensor(0);
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        request.get_input_tensor(1).data<int64_t>()[0] = iterations;
+        return request;
+    }
+
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(InferRequestPriorityCPUTest, HigherPriorityIsDispatchedFirst) {
+    // keeps the only stream busy until it is canceled
+    auto blocker = createRequest(std::numeric_limits<int32_t>::max());
+    auto low = createRequest(1);
+    low.set_property(ov::hint::priority(ov::hint::Priority::LOW));
+    auto high = createRequest(1);
+    high.set_property(ov::hint::priority(ov::hint::Priority::HIGH), ov::intel_cpu::latency_budget(1000000));
+
+    std::mutex mutex;
+    std::condition_variable completed;
+    std::vector<std::string> order;
+    auto record = [&](const std::string& name) {
+        return [&, name](std::exception_ptr) {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+            completed.notify_all();
+        };
+    };
+    low.set_callback(record("low"));
+    high.set_callback(record("high"));
+
+    blocker.start_async();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // the low priority request is started first, but both of them wait until the stream is free
+    low.start_async();
+    high.start_async();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    auto statistics = compiledModel.get_property(ov::intel_cpu::queue_statistics);
+    EXPECT_EQ(statistics.at("high_depth"), 1u);
+    EXPECT_EQ(statistics.at("low_depth"), 1u);
+
+    blocker.cancel();
+    EXPECT_THROW(blocker.wait(), ov::Cancelled);
+    ASSERT_NO_THROW(high.wait());
+    ASSERT_NO_THROW(low.wait());
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        ASSERT_TRUE(completed.wait_for(lock, std::chrono::seconds{60}, [&] {
+            return order.size() == 2;
+        }));
+    }
+    EXPECT_EQ(order, (std::vector<std::string>{"high", "low"}));
+
+    statistics = compiledModel.get_property(ov::intel_cpu::queue_statistics);
+    EXPECT_EQ(statistics.at("high_depth"), 0u);
+    EXPECT_EQ(statistics.at("low_depth"), 0u);
+    EXPECT_EQ(statistics.at("high_dispatched"), 1u);
+    EXPECT_EQ(statistics.at("low_dispatched"), 1u);
+    EXPECT_GT(statistics.at("low_max_delay_us"), 0u);
+    // the requests without the scheduling properties are not counted
+    EXPECT_EQ(statistics.at("medium_dispatched"), 0u);
+}
+
+TEST_F(InferRequestPriorityCPUTest, PropertiesOfRequest) {
+    auto request = createRequest(1);
+    ASSERT_NO_THROW(request.set_property(ov::hint::priority(ov::hint::Priority::HIGH)));
+    ASSERT_NO_THROW(request.infer());
+    EXPECT_THROW(request.set_property(ov::num_streams(2)), ov::Exception);
+
+    // the properties can't be changed while the request is running
+    auto blocker = createRequest(std::numeric_limits<int32_t>::max());
+    blocker.start_async();
+    EXPECT_THROW(blocker.set_property(ov::hint::priority(ov::hint::Priority::LOW)), ov::Busy);
+    blocker.cancel();
+    EXPECT_THROW(blocker.wait(), ov::Cancelled);
+}
+
+}  // namespace SubgraphTestsDefinitions
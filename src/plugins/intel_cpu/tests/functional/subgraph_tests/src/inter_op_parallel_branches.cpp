@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "internal_properties.hpp"
+
+#include <set>
+
+/*This test runs the following subgraph:
+
+                       param
+                         |
+                        Relu
+              /      /       \        \
+           Conv    Conv     Conv    MaxPool
+          (1x1)   (3x3)    (5x5)       |
+             |      |        |       Conv
+            Relu   Relu     Relu     (1x1)
+              |      |        |        |
+            Result Result   Result   Result
+
+The Inception-like block contains four independent branches which are executed simultaneously in the inter-op
+parallel mode. The intermediate tensors of the branches share the memory according to the memory reuse plan,
+so the test checks that the inter-op schedule respects it. The branches end with their own outputs rather than with
+an in-place Concat: the parts of the in-place Concat output share one memory, so the branches writing into it are
+serialized by the schedule.
+*/
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using InterOpParallelBranchesParams = std::tuple<ov::Shape,  // input shape
+                                                 bool>;      // inter-op parallelism
+
+class InterOpParallelBranchesCPUTest : public testing::WithParamInterface<InterOpParallelBranchesParams>,
+                                       virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelBranchesParams>& obj) {
+        ov::Shape inputShape;
+        bool interOp;
+        std::tie(inputShape, interOp) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_";
+        result << "InterOp=" << interOp;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape inputShape;
+        bool interOp;
+        std::tie(inputShape, interOp) = this->GetParam();
+        configuration.insert({ov::intel_cpu::inter_op_parallelism.name(), interOp});
+
+        const auto precision = ov::element::f32;
+        init_input_shapes({InputShape{{}, {inputShape}}});
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front())};
+        auto relu = std::make_shared<ov::op::v0::Relu>(params.front());
+
+        auto makeBranch = [&](const ov::Output<ov::Node>& in, size_t kernel, size_t channels) -> std::shared_ptr<ov::Node> {
+            const ptrdiff_t pad = static_cast<ptrdiff_t>(kernel / 2);
+            auto conv = ngraph::builder::makeConvolution(in, precision, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad},
+                                                         {1, 1}, ov::op::PadType::EXPLICIT, channels);
+            return std::make_shared<ov::op::v0::Relu>(conv);
+        };
+
+        auto pool = std::make_shared<ov::op::v1::MaxPool>(relu, ov::Strides{1, 1}, ov::Shape{1, 1}, ov::Shape{1, 1},
+                                                          ov::Shape{3, 3}, ov::op::RoundingType::FLOOR);
+        ov::ResultVector results;
+        for (const auto& branch : {makeBranch(relu, 1, 16), makeBranch(relu, 3, 24), makeBranch(relu, 5, 8), makeBranch(pool, 1, 16)})
+            results.push_back(std::make_shared<ov::op::v0::Result>(branch));
+        function = std::make_shared<ov::Model>(results, params, "InterOpParallelBranches");
+    }
+};
+
+TEST_P(InterOpParallelBranchesCPUTest, CompareWithRefs) {
+    run();
+
+    // the nodes executed simultaneously get the different lanes, a plan without such waves is dropped
+    bool interOp;
+    std::tie(std::ignore, interOp) = this->GetParam();
+    std::set<std::string> lanes;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find("interOpLane");
+        if (it != rtInfo.end())
+            lanes.insert(it->second.as<std::string>());
+    }
+    if (!interOp) {
+        EXPECT_TRUE(lanes.empty());
+    } else if (compiledModel.get_property(ov::inference_num_threads) > 1) {
+        EXPECT_GT(lanes.size(), 1);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallelBranches, InterOpParallelBranchesCPUTest,
+                         ::testing::Combine(::testing::Values(ov::Shape{1, 16, 14, 14}, ov::Shape{2, 8, 7, 7}),
+                                            ::testing::Values(true, false)),
+                         InterOpParallelBranchesCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
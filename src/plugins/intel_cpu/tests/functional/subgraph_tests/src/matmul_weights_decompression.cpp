@@ -206,6 +206,243 @@ TEST_P(MatmulWeightsDecompression, CompareWithRefs) {
     checkResults();
 }
 
+/*
+ *    Weights(U4/I4) [OC, G, GS]
+ *       |
+ *    Convert(F32)   Subtract_const(F32) [OC, G, 1]
+ *            \        /
+ *            Subtract(opt)   Multiply_const(F32) [OC, G, 1]
+ *                  \       /
+ *                   Multiply
+ *                      |
+ *                   Reshape [OC, IC]
+ *                      |
+ *      Data(F32)   Transpose(opt)
+ *            \     /
+ *             Matmul
+ */
+using MatmulGroupWiseWeightsDecompressionParams = std::tuple<std::vector<InputShape>,  // input shapes
+                                                             ov::test::ElementType,    // weights precision
+                                                             size_t,                   // group size
+                                                             bool,                     // decompression subtract
+                                                             std::map<std::string, std::string>>;  // additional config
+
+class MatmulGroupWiseWeightsDecompression : public testing::WithParamInterface<MatmulGroupWiseWeightsDecompressionParams>,
+                                            virtual public SubgraphBaseTest,
+                                            public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatmulGroupWiseWeightsDecompressionParams> obj) {
+        std::vector<InputShape> inputShapes;
+        ov::test::ElementType weights_precision;
+        size_t group_size;
+        bool decompression_sub;
+        std::map<std::string, std::string> additional_config;
+        std::tie(inputShapes, weights_precision, group_size, decompression_sub, additional_config) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            result << "(";
+            if (!shape.second.empty()) {
+                auto itr = shape.second.begin();
+                do {
+                    result << ov::test::utils::vec2str(*itr);
+                } while (++itr != shape.second.end() && result << "_");
+            }
+            result << ")_";
+        }
+        result << "weights_precision=" << weights_precision << "_";
+        result << "group_size=" << group_size << "_";
+        result << "decompression_subtract=" << decompression_sub << "_";
+
+        result << "config=(";
+        for (const auto& configEntry : additional_config) {
+            result << configEntry.first << ", " << configEntry.second << ":";
+        }
+        result << ")";
+
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initSubgraph(std::vector<ov::PartialShape>& inputShapes,
+                                            const ov::element::Type data_precision,
+                                            const ov::element::Type weights_precision,
+                                            const size_t group_size,
+                                            const bool add_subtract) {
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(data_precision, inputShapes[0])};
+        // inputShapes[1] is the MatMul weights shape [OC, IC]
+        const auto weights_2d_shape = inputShapes[1].to_shape();
+        const size_t output_channels = weights_2d_shape[0];
+        const size_t input_channels = weights_2d_shape[1];
+        const ov::Shape weights_shape{output_channels, input_channels / group_size, group_size};
+        const ov::Shape params_shape{output_channels, input_channels / group_size, 1};
+
+        const bool is_signed = weights_precision == ov::element::i4;
+        std::vector<int8_t> weights_values(ov::shape_size(weights_shape));
+        for (size_t i = 0; i < weights_values.size(); i++)
+            weights_values[i] = static_cast<int8_t>(is_signed ? static_cast<int>(i * 7 % 16) - 8 : i * 7 % 16);
+        auto weights = std::make_shared<ov::op::v0::Constant>(weights_precision, weights_shape, weights_values);
+        weights->set_friendly_name("Compressed_weights");
+        std::shared_ptr<ov::Node> mul_parent = std::make_shared<ngraph::opset1::Convert>(weights, data_precision);
+
+        if (add_subtract) {
+            auto shift_const = ngraph::builder::makeConstant<float>(data_precision, params_shape, {}, true, 2.f, 0.f);
+            mul_parent = std::make_shared<ov::opset10::Subtract>(mul_parent, shift_const);
+        }
+        auto scale_const = ngraph::builder::makeConstant<float>(data_precision, params_shape, {}, true, 0.1f, 0.01f);
+        auto multiply = std::make_shared<ov::opset10::Multiply>(mul_parent, scale_const);
+
+        auto reshape_const = ov::opset10::Constant::create(ov::element::i32, {2}, weights_2d_shape);
+        auto reshape = std::make_shared<ov::opset10::Reshape>(multiply, reshape_const, false);
+        auto matMul = builder::makeMatMul(params[0], reshape, false, true);
+        return makeNgraphFunction(data_precision, params, matMul, "MatmulGroupWiseWeightsDecompression");
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes;
+        ov::test::ElementType weights_precision;
+        size_t group_size;
+        bool decompression_sub;
+        std::map<std::string, std::string> additional_config;
+        std::tie(inputShapes, weights_precision, group_size, decompression_sub, additional_config) = GetParam();
+
+        configuration.insert(additional_config.begin(), additional_config.end());
+        init_input_shapes(inputShapes);
+
+        ElementType netType = element::f32;
+        inType = outType = netType;
+
+        function = initSubgraph(inputDynamicShapes, netType, weights_precision, group_size, decompression_sub);
+    }
+
+    void checkResults() {
+        // No decompression support on non-avx systems
+        if (!with_cpu_x86_avx2())
+            return;
+        // the 4-bit weights are kept as is, the FullyConnected node decompresses them
+        const auto weights_precision = std::get<1>(GetParam());
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            if (n->get_friendly_name() == "Compressed_weights") {
+                ASSERT_EQ(n->get_output_element_type(0), weights_precision);
+            }
+        }
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+    }
+};
+
+TEST_P(MatmulGroupWiseWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    checkResults();
+}
+
+/*
+ * The 4-bit weights the FullyConnected node doesn't decompress by itself are widened to 8 bits, the model is
+ * executed as usual.
+ *
+ *    Weights(U4/I4) [OC, IC] or [IC, OC]
+ *       |
+ *    Convert(F32)
+ *       |
+ *    Multiply   Multiply_const(F32) [1] or [OC, 1]
+ *       |
+ *    Transpose(opt)
+ *       |
+ *    Matmul
+ *       |
+ *     Relu(opt)
+ */
+enum class Int4WeightsPattern {
+    PerTensorScale,     // the scale is broadcasted from a scalar
+    TransposedWeights,  // the weights are [IC, OC] with a Transpose
+    FusedPostOp,        // the node output is activated
+};
+
+std::ostream& operator<<(std::ostream& os, Int4WeightsPattern pattern) {
+    switch (pattern) {
+    case Int4WeightsPattern::PerTensorScale:
+        return os << "PerTensorScale";
+    case Int4WeightsPattern::TransposedWeights:
+        return os << "TransposedWeights";
+    case Int4WeightsPattern::FusedPostOp:
+        return os << "FusedPostOp";
+    }
+    return os;
+}
+
+using MatmulInt4WeightsFallbackParams = std::tuple<ov::test::ElementType,  // weights precision
+                                                   Int4WeightsPattern>;
+
+class MatmulInt4WeightsFallback : public testing::WithParamInterface<MatmulInt4WeightsFallbackParams>,
+                                  virtual public SubgraphBaseTest,
+                                  public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatmulInt4WeightsFallbackParams> obj) {
+        ov::test::ElementType weights_precision;
+        Int4WeightsPattern pattern;
+        std::tie(weights_precision, pattern) = obj.param;
+
+        std::ostringstream result;
+        result << "weights_precision=" << weights_precision << "_";
+        result << "pattern=" << pattern;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        ov::test::ElementType weights_precision;
+        Int4WeightsPattern pattern;
+        std::tie(weights_precision, pattern) = GetParam();
+
+        const size_t input_channels = 64;
+        const size_t output_channels = 48;
+        init_input_shapes({{{}, {{2, 4, input_channels}}}});
+        const auto data_precision = ov::element::f32;
+        inType = outType = data_precision;
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(data_precision, inputDynamicShapes[0])};
+        const bool transposed = pattern == Int4WeightsPattern::TransposedWeights;
+        const auto weights_shape = transposed ? ov::Shape{input_channels, output_channels}
+                                              : ov::Shape{output_channels, input_channels};
+        const bool is_signed = weights_precision == ov::element::i4;
+        std::vector<int8_t> weights_values(ov::shape_size(weights_shape));
+        for (size_t i = 0; i < weights_values.size(); i++)
+            weights_values[i] = static_cast<int8_t>(is_signed ? static_cast<int>(i * 5 % 16) - 8 : i * 5 % 16);
+        auto weights = std::make_shared<ov::op::v0::Constant>(weights_precision, weights_shape, weights_values);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, data_precision);
+
+        const auto scale_shape = pattern == Int4WeightsPattern::PerTensorScale ? ov::Shape{1}
+                                 : transposed ? ov::Shape{1, output_channels}
+                                              : ov::Shape{output_channels, 1};
+        auto scale_const = ngraph::builder::makeConstant<float>(data_precision, scale_shape, {}, true, 0.1f, 0.01f);
+        std::shared_ptr<ov::Node> matmul_weights = std::make_shared<ov::opset10::Multiply>(convert, scale_const);
+        if (transposed) {
+            auto order = ov::opset10::Constant::create(ov::element::i32, {2}, {1, 0});
+            matmul_weights = std::make_shared<ov::opset10::Transpose>(matmul_weights, order);
+        }
+
+        std::shared_ptr<ov::Node> output = builder::makeMatMul(params[0], matmul_weights, false, true);
+        if (pattern == Int4WeightsPattern::FusedPostOp)
+            output = std::make_shared<ov::opset10::Relu>(output);
+        function = makeNgraphFunction(data_precision, params, output, "MatmulInt4WeightsFallback");
+    }
+};
+
+TEST_P(MatmulInt4WeightsFallback, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+}
+
 namespace {
 
 std::vector<std::map<std::string, std::string>> filterAdditionalConfigBasic() {
@@ -316,6 +553,37 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_corner_cases_big,
                                             ::testing::Values(emptyFusingSpec),
                                             ::testing::Values(shouldUseDecompressionKernelBig())),
                          MatmulWeightsDecompression::getTestCaseName);
+
+const std::vector<ov::test::ElementType> weights_precisions_int4 = {ov::element::u4, ov::element::i4};
+const std::vector<std::vector<InputShape>> input_shapes_group_wise = {
+    {{{-1, -1, -1}, {{1, 1, 128}, {10, 16, 128}}}, {{}, {{64, 128}}}},
+    {{{}, {{1, 4, 256}}}, {{}, {{37, 256}}}},
+};
+const std::vector<size_t> group_sizes = {32, 128};
+
+std::vector<std::map<std::string, std::string>> filterAdditionalConfigGroupWise() {
+    std::vector<std::map<std::string, std::string>> additional_config = {CPUTestUtils::cpuEmptyPluginConfig};
+    if (with_cpu_x86_bfloat16())
+        additional_config.push_back({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}});
+    return additional_config;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_group_wise,
+                         MatmulGroupWiseWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_group_wise),
+                                            ::testing::ValuesIn(weights_precisions_int4),
+                                            ::testing::ValuesIn(group_sizes),
+                                            ::testing::ValuesIn(add_decompression_sub),
+                                            ::testing::ValuesIn(filterAdditionalConfigGroupWise())),
+                         MatmulGroupWiseWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_int4_fallback,
+                         MatmulInt4WeightsFallback,
+                         ::testing::Combine(::testing::ValuesIn(weights_precisions_int4),
+                                            ::testing::Values(Int4WeightsPattern::PerTensorScale,
+                                                              Int4WeightsPattern::TransposedWeights,
+                                                              Int4WeightsPattern::FusedPostOp)),
+                         MatmulInt4WeightsFallback::getTestCaseName);
 } // namespace
 
 } // namespace SubgraphTestsDefinitions
@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The runtime cache of a compiled model with a user defined CPU_RUNTIME_CACHE_CAPACITY (including 0 and capacities small
+// enough to evict records) is looked up, while the nodes of a dynamic graph update their shapes and executors from
+// several threads.
+// The test runs a set of independent branches, each of them looking up the same cache, on a single stream using all the
+// threads and changes the input shapes on every inference.
+
+//  ---------       ---------
+//  |input 0|       |input 1|
+//  ---------       ---------
+//      |               |
+//  --------------------------  x branches
+//  | MatMul -> Add -> Relu  |
+//  --------------------------
+//              |
+//          --------
+//          |concat|
+//          --------
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using RuntimeCacheRecordsModeParams = std::string;  // runtime cache capacity
+
+class RuntimeCacheRecordsModeTest : public testing::WithParamInterface<RuntimeCacheRecordsModeParams>,
+                                    virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RuntimeCacheRecordsModeParams>& obj) {
+        return "capacity=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto capacity = GetParam();
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, capacity});
+        configuration.insert(ov::num_streams(1));
+
+        const std::vector<InputShape> inputShapes = {
+            {{-1, -1, 32}, {{1, 16, 32}, {2, 7, 32}, {1, 33, 32}, {1, 16, 32}, {3, 5, 32}}},
+            {{-1, -1, 32}, {{1, 16, 32}, {2, 7, 32}, {1, 33, 32}, {1, 16, 32}, {3, 5, 32}}},
+        };
+        init_input_shapes(inputShapes);
+
+        const auto precision = ov::element::f32;
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes)
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+
+        constexpr size_t branches = 8;
+        ov::OutputVector concatInputs;
+        for (size_t i = 0; i < branches; i++) {
+            const auto& input = params[i % params.size()];
+            auto weights = ngraph::builder::makeConstant<float>(precision, {32, 32}, {}, true);
+            auto matMul = std::make_shared<ov::op::v0::MatMul>(input, weights);
+            auto bias = ngraph::builder::makeConstant<float>(precision, {1, 1, 32}, {}, true);
+            auto add = std::make_shared<ov::op::v1::Add>(matMul, bias);
+            auto relu = std::make_shared<ov::op::v0::Relu>(add);
+            concatInputs.push_back(relu);
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(concatInputs, 2);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(concat)};
+        function = std::make_shared<ov::Model>(results, params, "RuntimeCacheRecordsMode");
+    }
+};
+
+TEST_P(RuntimeCacheRecordsModeTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_RuntimeCacheRecordsMode, RuntimeCacheRecordsModeTest,
+                         ::testing::Values("0", "2", "100"),
+                         RuntimeCacheRecordsModeTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
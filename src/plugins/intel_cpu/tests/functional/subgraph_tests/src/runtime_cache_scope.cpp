@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The runtime cache is shared by the graphs of the streams of a compiled model only. The cache keys of the executors
+// don't encode every config field affecting them (e.g. the inference precision or the denormals mode), so a model
+// compiled with another config must never look up the primitives created for the first one.
+// The test compiles the same model twice on a single stream (so the number of lookups is deterministic) and checks
+// that the lookups of the second model don't hit the records of the first one and don't change its statistics.
+
+#include <ngraph_functions/builders.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+class RuntimeCacheScopeCPUTest : public testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 16, 64});
+        std::shared_ptr<ov::Node> node = param;
+        for (size_t i = 0; i < 4; i++) {
+            auto weights = ngraph::builder::makeConstant<float>(precision, {64, 64}, {}, true);
+            node = std::make_shared<ov::op::v0::MatMul>(node, weights);
+            node = std::make_shared<ov::op::v0::Relu>(node);
+        }
+        model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(node)},
+                                            ov::ParameterVector{param}, "RuntimeCacheScope");
+    }
+
+    static std::map<std::string, uint64_t> statistics(const ov::CompiledModel& compiledModel) {
+        return compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+    }
+
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(RuntimeCacheScopeCPUTest, CacheIsNotSharedBetweenCompiledModels) {
+    const ov::AnyMap config = {ov::num_streams(1)};
+    auto first = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+    auto firstRequest = first.create_infer_request();
+    firstRequest.infer();
+    const auto firstStatistics = statistics(first);
+    ASSERT_GT(firstStatistics.at("misses"), 0u);
+
+    auto second = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+    auto secondRequest = second.create_infer_request();
+    secondRequest.infer();
+    const auto secondStatistics = statistics(second);
+
+    // the second model creates its own executors instead of finding the ones of the first model
+    EXPECT_EQ(secondStatistics.at("misses"), firstStatistics.at("misses"));
+    EXPECT_EQ(statistics(first), firstStatistics);
+}
+
+}  // namespace SubgraphTestsDefinitions
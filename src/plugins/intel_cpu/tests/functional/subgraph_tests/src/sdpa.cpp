@@ -0,0 +1,229 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "ie_system_conf.h"
+#include "openvino/runtime/core.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class AttentionMask {
+    NONE,
+    ADDITIVE,
+    CAUSAL
+};
+
+typedef std::tuple<
+    std::vector<InputShape>,  // query, key, value and mask shapes
+    AttentionMask,
+    ElementType               // inference precision
+> SDPATestParams;
+
+// the causal mask as the PyTorch frontend builds it for aten::scaled_dot_product_attention(..., is_causal=True)
+static std::shared_ptr<ov::Node> makeCausalMask(const ov::Output<ov::Node>& query, const ov::Output<ov::Node>& key) {
+    auto zero = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {0});
+    auto one = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {1});
+    auto axis = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {-2});
+    auto targetLen = std::make_shared<ov::opset8::Gather>(std::make_shared<ov::opset4::ShapeOf>(query, ov::element::i32), axis, zero);
+    auto sourceLen = std::make_shared<ov::opset8::Gather>(std::make_shared<ov::opset4::ShapeOf>(key, ov::element::i32), axis, zero);
+    auto horizontal = std::make_shared<ov::opset4::Range>(zero, sourceLen, one, ov::element::i32);
+    auto vertical = std::make_shared<ov::opset4::Range>(one, std::make_shared<ov::opset1::Add>(targetLen, one), one, ov::element::i32);
+    auto triu = std::make_shared<ov::opset1::GreaterEqual>(std::make_shared<ov::opset1::Unsqueeze>(horizontal, zero),
+                                                           std::make_shared<ov::opset1::Unsqueeze>(vertical, one));
+    auto maskShape = std::make_shared<ov::opset1::Concat>(ov::OutputVector{std::make_shared<ov::opset1::Unsqueeze>(targetLen, zero),
+                                                                           std::make_shared<ov::opset1::Unsqueeze>(sourceLen, zero)}, 0);
+    auto minusInf = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {-std::numeric_limits<float>::infinity()});
+    auto zeroF = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.f});
+    return std::make_shared<ov::opset1::Select>(triu, std::make_shared<ov::opset4::Broadcast>(minusInf, maskShape), zeroF);
+}
+
+class SDPACPUTest : public testing::WithParamInterface<SDPATestParams>, virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SDPATestParams> &obj) {
+        std::vector<InputShape> inputShapes;
+        AttentionMask mask;
+        ElementType precision;
+        std::tie(inputShapes, mask, precision) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=(";
+        for (const auto& shape : inputShapes) {
+            results << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        results << ")_TS=(";
+        for (const auto& shape : inputShapes) {
+            for (const auto& item : shape.second) {
+                results << ov::test::utils::vec2str(item) << "_";
+            }
+        }
+        results << ")_mask=" << (mask == AttentionMask::NONE ? "none" : mask == AttentionMask::ADDITIVE ? "additive" : "causal");
+        results << "_Prc=" << precision;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        std::vector<InputShape> inputShapes;
+        AttentionMask maskType;
+        ElementType precision;
+        std::tie(inputShapes, maskType, precision) = this->GetParam();
+        init_input_shapes(inputShapes);
+
+        ov::ParameterVector params;
+        for (const auto& shape : inputDynamicShapes)
+            params.push_back(std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape));
+
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.125f});
+        auto query = std::make_shared<ov::opset1::Multiply>(params[0], scale);
+        std::shared_ptr<ov::Node> scores = std::make_shared<ov::opset1::MatMul>(query, params[1], false, true);
+        if (maskType == AttentionMask::ADDITIVE) {
+            scores = std::make_shared<ov::opset1::Add>(scores, params[3]);
+        } else if (maskType == AttentionMask::CAUSAL) {
+            scores = std::make_shared<ov::opset1::Add>(scores, makeCausalMask(params[0], params[1]));
+        }
+        auto softmax = std::make_shared<ov::opset8::Softmax>(scores, -1);
+        auto attention = std::make_shared<ov::opset1::MatMul>(softmax, params[2]);
+        function = std::make_shared<ov::Model>(ov::NodeVector{attention}, params, "ScaledDotProductAttention");
+
+        if (!configuration.count(InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE)) {
+            configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                                  InferenceEngine::PluginConfigInternalParams::DISABLE});
+        }
+        if (precision == ElementType::bf16) {
+            // the scores and the probabilities are accumulated in f32, the inputs and the output are rounded
+            abs_threshold = 0.1f;
+            rel_threshold = 10.f;
+            configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES});
+        }
+    }
+};
+
+TEST_P(SDPACPUTest, CompareWithRefs) {
+    if (std::get<2>(GetParam()) == ElementType::bf16 && !InferenceEngine::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+}
+
+namespace {
+
+// the sequence lengths change between the inferences and cross the blocks of the kernel
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        InputShape{{-1, 4, -1, 64}, {{1, 4, 10, 64}, {2, 4, 50, 64}, {1, 4, 1, 64}}},
+        InputShape{{-1, 4, -1, 64}, {{1, 4, 10, 64}, {2, 4, 300, 64}, {1, 4, 301, 64}}},
+        InputShape{{-1, 4, -1, 64}, {{1, 4, 10, 64}, {2, 4, 300, 64}, {1, 4, 301, 64}}},
+        InputShape{{-1, 1, -1, -1}, {{1, 1, 10, 10}, {2, 1, 50, 300}, {1, 1, 1, 301}}}
+    },
+    {
+        InputShape{{-1, -1, 32}, {{8, 33, 32}, {8, 7, 32}}},
+        InputShape{{-1, -1, 32}, {{1, 33, 32}, {1, 7, 32}}},
+        InputShape{{-1, -1, 16}, {{1, 33, 16}, {1, 7, 16}}},
+        InputShape{{-1, -1}, {{33, 33}, {7, 7}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPA, SDPACPUTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(AttentionMask::NONE, AttentionMask::ADDITIVE),
+                                           ::testing::Values(ElementType::f32)),
+                        SDPACPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPA_BF16, SDPACPUTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(AttentionMask::NONE, AttentionMask::ADDITIVE),
+                                           ::testing::Values(ElementType::bf16)),
+                        SDPACPUTest::getTestCaseName);
+
+// the causal mask requires the queries and the keys of the same length as the PyTorch frontend creates it
+const std::vector<std::vector<InputShape>> causalInputShapes = {
+    {
+        InputShape{{-1, 4, -1, 64}, {{1, 4, 10, 64}, {2, 4, 300, 64}, {1, 4, 1, 64}}},
+        InputShape{{-1, 4, -1, 64}, {{1, 4, 10, 64}, {2, 4, 300, 64}, {1, 4, 1, 64}}},
+        InputShape{{-1, 4, -1, 64}, {{1, 4, 10, 64}, {2, 4, 300, 64}, {1, 4, 1, 64}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPA_Causal, SDPACPUTest,
+                        ::testing::Combine(::testing::ValuesIn(causalInputShapes),
+                                           ::testing::Values(AttentionMask::CAUSAL),
+                                           ::testing::Values(ElementType::f32, ElementType::bf16)),
+                        SDPACPUTest::getTestCaseName);
+} // namespace
+
+// Measures the latency of the fused node against the unfused MatMul -> Softmax -> MatMul chain for the growing
+// sequence lengths. The fusion is blocked in the baseline by the softmax exposed as an additional output.
+class SDPABenchmarkCPUTest : public testing::WithParamInterface<size_t>, public testing::Test {
+protected:
+    static std::shared_ptr<ov::Model> makeAttention(size_t seqLen, bool fused) {
+        const ov::Shape shape{1, 16, seqLen, 64};
+        ov::ParameterVector params;
+        for (size_t i = 0; i < 3; i++)
+            params.push_back(std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape));
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.125f});
+        auto query = std::make_shared<ov::opset1::Multiply>(params[0], scale);
+        auto scores = std::make_shared<ov::opset1::MatMul>(query, params[1], false, true);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(scores, -1);
+        auto attention = std::make_shared<ov::opset1::MatMul>(softmax, params[2]);
+        ov::ResultVector results{std::make_shared<ov::opset1::Result>(attention)};
+        if (!fused)
+            results.push_back(std::make_shared<ov::opset1::Result>(softmax));
+        return std::make_shared<ov::Model>(results, params, "ScaledDotProductAttention");
+    }
+
+    static double measure(const std::shared_ptr<ov::Model>& model, bool fused) {
+        constexpr size_t iterations = 20;
+        ov::Core core;
+        auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+            {{InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE, InferenceEngine::PluginConfigInternalParams::DISABLE}});
+        CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", fused ? 1 : 0);
+
+        auto request = compiledModel.create_infer_request();
+        for (const auto& input : compiledModel.inputs()) {
+            request.set_tensor(input, ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape(),
+                                                                              2, -1, 1000));
+        }
+        // warm up
+        request.infer();
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            request.infer();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+};
+
+TEST_P(SDPABenchmarkCPUTest, FusedVsUnfused) {
+    const auto seqLen = GetParam();
+    const auto fused = measure(makeAttention(seqLen, true), true);
+    const auto unfused = measure(makeAttention(seqLen, false), false);
+    std::cout << "[ LATENCY ] seq_len: " << seqLen << ", fused: " << fused << " ms, unfused: " << unfused
+              << " ms, speedup: " << unfused / fused << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPA_Benchmark,
+                         SDPABenchmarkCPUTest,
+                         ::testing::Values(128, 512, 2048),
+                         [](const ::testing::TestParamInfo<size_t>& info) {
+                             return "seq_len_" + std::to_string(info.param);
+                         });
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The variable states of an infer request own the memory the graph reads the state from and writes the new state into
+// (two buffers swapped after each inference), so the state is not copied into the graph and out of it. The reset of
+// the state is lazy. The tests check the values of the states after the reset and after the state is set, and
+// a request executed by the graphs of different streams, for the models whose state memory is read and written
+// by the nodes in place and for the models whose state has to be copied.
+
+#include <ngraph_functions/builders.hpp>
+#include <openvino/op/util/variable.hpp>
+#include <openvino/opsets/opset6.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+enum class StateUpdate {
+    InPlace,  // ReadValue -> MatMul -> Add -> Assign, out = previous state, the nodes work with the state memory
+    Copied,   // ReadValue -> Add -> Assign and Result, out = new state, the Add output is shared with the Result
+};
+
+std::ostream& operator<<(std::ostream& os, StateUpdate update) {
+    switch (update) {
+    case StateUpdate::InPlace:
+        return os << "InPlace";
+    case StateUpdate::Copied:
+        return os << "Copied";
+    }
+    return os;
+}
+
+class VariableStateMemoryCPUTest : public testing::WithParamInterface<StateUpdate>, public testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StateUpdate>& obj) {
+        std::ostringstream result;
+        result << "Update=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t size = 16;
+
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        const auto precision = ov::element::f32;
+        auto x = std::make_shared<ov::opset6::Parameter>(precision, ov::Shape{1, size});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{ov::PartialShape{1, size}, precision, "state"});
+        auto init = ngraph::builder::makeConstant<float>(precision, {1, size}, {0.f});
+        auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+
+        std::shared_ptr<ov::Node> output;
+        std::shared_ptr<ov::Node> newState;
+        if (GetParam() == StateUpdate::InPlace) {
+            std::vector<float> identity(size * size, 0.f);
+            for (size_t i = 0; i < size; i++)
+                identity[i * size + i] = 1.f;
+            auto weights = ngraph::builder::makeConstant<float>(precision, {size, size}, identity);
+            output = std::make_shared<ov::opset6::MatMul>(readValue, weights);
+            newState = std::make_shared<ov::opset6::Add>(output, x);
+        } else {
+            newState = std::make_shared<ov::opset6::Add>(readValue, x);
+            output = newState;
+        }
+        auto assign = std::make_shared<ov::opset6::Assign>(newState, variable);
+        auto result = std::make_shared<ov::opset6::Result>(output);
+        model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{x},
+                                            "VariableStateMemory");
+    }
+
+    ov::CompiledModel compile(int streams = 1) {
+        // the values are small integers, so they are exact in any precision, but the weights are kept f32 anyway
+        return core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                  {ov::num_streams(streams), ov::hint::inference_precision(ov::element::f32)});
+    }
+
+    static void setInput(ov::InferRequest& request, float value) {
+        auto tensor = request.get_input_tensor(0);
+        std::fill_n(tensor.data<float>(), tensor.get_size(), value);
+    }
+
+    static void expectValue(const ov::Tensor& tensor, float value) {
+        const auto* data = tensor.data<const float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            ASSERT_EQ(data[i], value) << "at " << i;
+    }
+
+    // runs the inference and checks the output for the state before the inference
+    void inferAndCheck(ov::InferRequest& request, float state, float x) {
+        setInput(request, x);
+        request.infer();
+        expectValue(request.get_output_tensor(0), GetParam() == StateUpdate::InPlace ? state : state + x);
+    }
+
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_P(VariableStateMemoryCPUTest, ResetIsLazy) {
+    auto compiledModel = compile();
+    auto request = compiledModel.create_infer_request();
+    auto states = request.query_state();
+    ASSERT_EQ(states.size(), 1u);
+    auto& state = states.front();
+
+    inferAndCheck(request, 0.f, 1.f);
+    inferAndCheck(request, 1.f, 2.f);
+    expectValue(state.get_state(), 3.f);
+
+    // the inference after the reset reads zeros, though the state memory is not cleared
+    state.reset();
+    inferAndCheck(request, 0.f, 4.f);
+    expectValue(state.get_state(), 4.f);
+
+    // the state read after the reset is zero filled
+    state.reset();
+    expectValue(state.get_state(), 0.f);
+    inferAndCheck(request, 0.f, 5.f);
+    inferAndCheck(request, 5.f, 1.f);
+    expectValue(state.get_state(), 6.f);
+}
+
+TEST_P(VariableStateMemoryCPUTest, SetStateAfterReset) {
+    auto compiledModel = compile();
+    auto request = compiledModel.create_infer_request();
+    auto states = request.query_state();
+    ASSERT_EQ(states.size(), 1u);
+    auto& state = states.front();
+
+    inferAndCheck(request, 0.f, 3.f);
+
+    // the set state cancels the pending reset
+    state.reset();
+    ov::Tensor newState(ov::element::f32, ov::Shape{1, size});
+    std::fill_n(newState.data<float>(), newState.get_size(), 5.f);
+    state.set_state(newState);
+    expectValue(state.get_state(), 5.f);
+    inferAndCheck(request, 5.f, 1.f);
+    expectValue(state.get_state(), 6.f);
+
+    // the state set twice between the inferences, the last one wins whatever buffer is current
+    std::fill_n(newState.data<float>(), newState.get_size(), 7.f);
+    state.set_state(newState);
+    std::fill_n(newState.data<float>(), newState.get_size(), 2.f);
+    state.set_state(newState);
+    inferAndCheck(request, 2.f, 2.f);
+    inferAndCheck(request, 4.f, 2.f);
+    expectValue(state.get_state(), 6.f);
+
+    // the reset after the state was set
+    state.set_state(newState);
+    state.reset();
+    inferAndCheck(request, 0.f, 1.f);
+    expectValue(state.get_state(), 1.f);
+}
+
+TEST_P(VariableStateMemoryCPUTest, RequestsOnSeveralStreams) {
+    // the requests run simultaneously on the two streams, so over the rounds each request is executed by the graphs
+    // of both streams, the graph must work with the state memory of the request it executes
+    auto compiledModel = compile(2);
+    std::vector<ov::InferRequest> requests;
+    std::vector<float> states;
+    for (size_t i = 0; i < 2; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        states.push_back(0.f);
+    }
+
+    constexpr size_t rounds = 16;
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            setInput(requests[i], static_cast<float>(i + 1));
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            const float x = static_cast<float>(i + 1);
+            expectValue(requests[i].get_output_tensor(0),
+                        GetParam() == StateUpdate::InPlace ? states[i] : states[i] + x);
+            states[i] += x;
+        }
+    }
+    for (size_t i = 0; i < requests.size(); i++)
+        expectValue(requests[i].query_state().front().get_state(), states[i]);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_VariableStateMemory, VariableStateMemoryCPUTest,
+                         ::testing::Values(StateUpdate::InPlace, StateUpdate::Copied),
+                         VariableStateMemoryCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -6,9 +6,18 @@
 #include <gtest/gtest.h>
 
 #include <cpu_memory.h>
+#include <arena_mem_mgr.h>
+#include <openvino/runtime/system_conf.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
 #include <mutex>
 #include <thread>
 #include <condition_variable>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
@@ -77,3 +86,156 @@ TEST(MemoryTest, ConcurrentResizeGetPrimitive) {
         ASSERT_EQ(dnnl_mem.get_data_handle(), cpu_mem2.getData());
     }
 }
+
+TEST(MemoryTest, MemoryMngrWithReuseGrowth) {
+    MemoryMngrWithReuse exactMngr;
+    ASSERT_TRUE(exactMngr.resize(100));
+    ASSERT_FALSE(exactMngr.resize(50));
+    ASSERT_TRUE(exactMngr.resize(101));
+    ASSERT_TRUE(exactMngr.resize(102));
+
+    MemoryMngrWithReuse growingMngr(2.0f);
+    // the first allocation is exact
+    ASSERT_TRUE(growingMngr.resize(100));
+    ASSERT_FALSE(growingMngr.resize(100));
+    // then the buffer grows geometrically
+    ASSERT_TRUE(growingMngr.resize(101));
+    for (size_t size = 102; size <= 200; ++size) {
+        ASSERT_FALSE(growingMngr.resize(size));
+    }
+    ASSERT_TRUE(growingMngr.resize(201));
+    ASSERT_NE(growingMngr.getRawPtr(), nullptr);
+    ASSERT_FALSE(growingMngr.hasExtBuffer());
+}
+
+TEST(MemoryTest, MemoryMngrWithReuseHugePages) {
+    constexpr size_t hugePageSize = MemoryAllocator::hugePageSize;
+    MemoryMngrWithReuse mngr(1.0f, MemoryAllocator::getDefault(HugePagesMode::Transparent));
+    // the small buffers are allocated as usual
+    ASSERT_TRUE(mngr.resize(100));
+    // the large ones are rounded up to and aligned on the huge page size
+    ASSERT_TRUE(mngr.resize(hugePageSize + 1));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(mngr.getRawPtr()) % hugePageSize, 0);
+    ASSERT_FALSE(mngr.resize(2 * hugePageSize));
+    ASSERT_TRUE(mngr.resize(2 * hugePageSize + 1));
+}
+
+TEST(MemoryTest, MemoryAllocatorStatistics) {
+    constexpr size_t hugePageSize = MemoryAllocator::hugePageSize;
+    auto statistics = std::make_shared<MemoryStatistics>();
+    // the explicit huge pages fall back to the transparent ones if the hugetlbfs pool is not configured
+    MemoryAllocator allocator(HugePagesMode::Explicit, -1, statistics);
+    {
+        size_t smallSize = 100;
+        auto small = allocator.allocate(smallSize);
+        ASSERT_NE(small, nullptr);
+        ASSERT_EQ(smallSize, 100);
+
+        size_t largeSize = hugePageSize + 1;
+        auto large = allocator.allocate(largeSize);
+        ASSERT_NE(large, nullptr);
+        ASSERT_EQ(largeSize, 2 * hugePageSize);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(large.get()) % hugePageSize, 0);
+
+        ASSERT_EQ(statistics->allocated, smallSize + largeSize);
+        ASSERT_EQ(statistics->explicitHugePages + statistics->transparentHugePages, largeSize);
+    }
+    ASSERT_EQ(statistics->allocated, 0);
+    ASSERT_EQ(statistics->explicitHugePages, 0);
+    ASSERT_EQ(statistics->transparentHugePages, 0);
+
+    // the memory managers account their buffers in the statistics of the allocator
+    MemoryMngrWithReuse mngr(1.0f, std::make_shared<MemoryAllocator>(HugePagesMode::Disabled, -1, statistics));
+    ASSERT_TRUE(mngr.resize(1000));
+    ASSERT_EQ(statistics->allocated, 1000);
+    ASSERT_EQ(statistics->transparentHugePages, 0);
+}
+
+TEST(MemoryTest, DynamicMemoryArena) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto statistics = std::make_shared<MemoryStatistics>();
+    auto arena = std::make_shared<DynamicMemoryArena>(
+        std::make_shared<MemoryAllocator>(HugePagesMode::Disabled, -1, statistics));
+    auto mngr1 = arena->createMemoryMngr();
+    auto mngr2 = arena->createMemoryMngr();
+
+    // the first inference allocates the buffers aside, the arena is empty yet
+    Memory mem1(eng, std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{250}), mngr1);
+    Memory mem2(eng, std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{750}), mngr2);
+    ASSERT_EQ(arena->getFallbackAllocations(), 2);
+    ASSERT_EQ(arena->getCapacity(), 0);
+
+    // the reset moves the buffers into the arena and updates the memory objects
+    arena->reset();
+    ASSERT_EQ(arena->getCapacity(), 1024 + 3008);
+    auto* block = static_cast<uint8_t*>(mngr1->getRawPtr());
+    ASSERT_EQ(mngr2->getRawPtr(), block + 1024);
+    ASSERT_EQ(mem1.getData(), mngr1->getRawPtr());
+    ASSERT_EQ(mem2.getPrimitive().get_data_handle(), mngr2->getRawPtr());
+
+    // the inferences with the same shapes run in the arena
+    for (int i = 0; i < 3; i++) {
+        ASSERT_FALSE(mngr1->resize(1000));
+        ASSERT_FALSE(mngr2->resize(3000));
+        arena->reset();
+        ASSERT_EQ(mngr1->getRawPtr(), block);
+    }
+    ASSERT_EQ(arena->getFallbackAllocations(), 2);
+
+    // a grown tensor doesn't fit into the arena, which grows geometrically after the inference
+    mem2.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{1250}));
+    ASSERT_EQ(arena->getFallbackAllocations(), 3);
+    ASSERT_EQ(arena->getPeakUsage(), 1024 + 3008 + 5000);
+    arena->reset();
+    ASSERT_EQ(arena->getCapacity(), 6080);
+    ASSERT_EQ(static_cast<uint8_t*>(mngr2->getRawPtr()), static_cast<uint8_t*>(mngr1->getRawPtr()) + 1024);
+    ASSERT_EQ(mem2.getData(), mngr2->getRawPtr());
+
+    // the external buffers are not placed in the arena
+    std::vector<float> external(250);
+    mngr1->setExtBuff(external.data(), external.size() * sizeof(float));
+    ASSERT_EQ(mem1.getData(), external.data());
+
+    ASSERT_EQ(statistics->arenaFallbackAllocations, 3);
+    ASSERT_EQ(statistics->arenaPeakUsage, arena->getPeakUsage());
+    ASSERT_EQ(statistics->allocated, arena->getCapacity());
+}
+
+#if defined(__linux__)
+namespace {
+// the fraction of the pages of the buffer which are placed on the other NUMA nodes
+double remotePagesFraction(void* ptr, size_t size, int numaNodeId) {
+    constexpr int mpolFNode = 1, mpolFAddr = 2;  // MPOL_F_NODE | MPOL_F_ADDR query the node of the page
+    size_t pages = 0, remote = 0;
+    for (size_t offset = 0; offset < size; offset += MemoryAllocator::pageSize) {
+        int node = -1;
+        if (syscall(SYS_get_mempolicy, &node, nullptr, 0, static_cast<char*>(ptr) + offset, mpolFNode | mpolFAddr) != 0)
+            continue;
+        pages++;
+        remote += node != numaNodeId;
+    }
+    return pages ? static_cast<double>(remote) / pages : 0.0;
+}
+}  // namespace
+
+// Run on a multi-node machine or under "numactl --interleave=all" to see the default placement spread over the nodes
+TEST(MemoryTest, MemoryMngrWithReuseNumaLocal) {
+    constexpr size_t size = 32 * 1024 * 1024;
+    const int numaNodeId = std::max(0, ov::get_available_numa_nodes().back());
+
+    // the default placement follows the policy of the process for the thread touching the buffer first
+    MemoryMngrWithReuse defaultMngr;
+    ASSERT_TRUE(defaultMngr.resize(size));
+    std::memset(defaultMngr.getRawPtr(), 0, size);
+
+    MemoryMngrWithReuse localMngr(1.0f, std::make_shared<MemoryAllocator>(HugePagesMode::Disabled, numaNodeId));
+    ASSERT_TRUE(localMngr.resize(size));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(localMngr.getRawPtr()) % MemoryAllocator::pageSize, 0);
+
+    const auto defaultRemote = remotePagesFraction(defaultMngr.getRawPtr(), size, numaNodeId);
+    const auto localRemote = remotePagesFraction(localMngr.getRawPtr(), size, numaNodeId);
+    std::cout << "[ REMOTE   ] pages off node " << numaNodeId << ": default placement " << 100 * defaultRemote
+              << "%, numa local " << 100 * localRemote << "%" << std::endl;
+    EXPECT_LE(localRemote, defaultRemote);
+}
+#endif
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "hybrid_node_placement.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+using CoreType = HybridNodePlacement::CoreType;
+
+// simulated processors type tables: ALL_PROC | MAIN_CORE_PROC | EFFICIENT_CORE_PROC | HYPER_THREADING_PROC |
+// PROC_NUMA_NODE_ID | PROC_SOCKET_ID
+const std::vector<std::vector<int>> hybridTable = {{24, 8, 8, 8, 0, 0}};
+const std::vector<std::vector<int>> nonHybridTable = {{16, 8, 0, 8, 0, 0}};
+const std::vector<std::vector<int>> efficientOnlyTable = {{8, 0, 8, 0, 0, 0}};
+
+}  // namespace
+
+TEST(HybridNodePlacementTest, SplitsProcessorsByCoreType) {
+    HybridNodePlacement withHyperThreading{hybridTable, true};
+    EXPECT_TRUE(withHyperThreading.isHybrid());
+    EXPECT_EQ(withHyperThreading.getThreads(CoreType::Performance), 16);
+    EXPECT_EQ(withHyperThreading.getThreads(CoreType::Efficient), 8);
+
+    HybridNodePlacement withoutHyperThreading{hybridTable, false};
+    EXPECT_TRUE(withoutHyperThreading.isHybrid());
+    EXPECT_EQ(withoutHyperThreading.getThreads(CoreType::Performance), 8);
+    EXPECT_EQ(withoutHyperThreading.getThreads(CoreType::Efficient), 8);
+
+    EXPECT_FALSE(HybridNodePlacement(nonHybridTable, true).isHybrid());
+    EXPECT_FALSE(HybridNodePlacement(efficientOnlyTable, true).isHybrid());
+    EXPECT_FALSE(HybridNodePlacement({}, true).isHybrid());
+}
+
+TEST(HybridNodePlacementTest, ClassifiesByArithmeticIntensity) {
+    // 3x3 convolution 64->64 channels on 56x56 fp32: 2 * 64 * 56 * 56 * 576 operations
+    const uint64_t convOutput = 64 * 56 * 56;
+    const HybridNodePlacement::NodeCost convolution{2 * convOutput * 576, (2 * convOutput + 64 * 576) * 4};
+    EXPECT_EQ(HybridNodePlacement::classify(convolution), CoreType::Performance);
+
+    // eltwise add of two fp32 tensors
+    const HybridNodePlacement::NodeCost eltwise{convOutput, 3 * convOutput * 4};
+    EXPECT_EQ(HybridNodePlacement::classify(eltwise), CoreType::Efficient);
+
+    // reorder of an fp32 tensor
+    const HybridNodePlacement::NodeCost reorder{convOutput, 2 * convOutput * 4};
+    EXPECT_EQ(HybridNodePlacement::classify(reorder), CoreType::Efficient);
+
+    EXPECT_EQ(HybridNodePlacement::classify({0, 0}), CoreType::Efficient);
+}
+
+TEST(HybridNodePlacementTest, TakesReductionDimOfMatMul) {
+    // FullyConnected of a 3D input [2, 128, 768] by the weights [3072, 768]
+    EXPECT_EQ(HybridNodePlacement::matMulReduction({3072, 768}, {2, 128, 3072}), 768);
+    // MatMul [8, 128, 64] x [8, 64, 128] and the transposed second input [8, 128, 64]
+    EXPECT_EQ(HybridNodePlacement::matMulReduction({8, 64, 128}, {8, 128, 128}), 64);
+    EXPECT_EQ(HybridNodePlacement::matMulReduction({8, 128, 64}, {8, 128, 128}), 64);
+    // square weights and a vector second input
+    EXPECT_EQ(HybridNodePlacement::matMulReduction({256, 256}, {4, 256}), 256);
+    EXPECT_EQ(HybridNodePlacement::matMulReduction({512}, {4, 1}), 512);
+}
+
+TEST(HybridNodePlacementTest, GroupsConsecutiveNodesIntoSegments) {
+    const auto segments = HybridNodePlacement::makeSegments({CoreType::Efficient,
+                                                             CoreType::Performance,
+                                                             CoreType::Performance,
+                                                             CoreType::Efficient,
+                                                             CoreType::Efficient,
+                                                             CoreType::Performance});
+    ASSERT_EQ(segments.size(), 4);
+    const std::vector<CoreType> coreTypes{CoreType::Efficient,
+                                          CoreType::Performance,
+                                          CoreType::Efficient,
+                                          CoreType::Performance};
+    const std::vector<size_t> begins{0, 1, 3, 5};
+    const std::vector<size_t> ends{1, 3, 5, 6};
+    for (size_t i = 0; i < segments.size(); i++) {
+        EXPECT_EQ(segments[i].coreType, coreTypes[i]);
+        EXPECT_EQ(segments[i].begin, begins[i]);
+        EXPECT_EQ(segments[i].end, ends[i]);
+    }
+
+    EXPECT_TRUE(HybridNodePlacement::makeSegments({}).empty());
+}
+
+TEST(HybridNodePlacementTest, RunsBodyOnSubArenaAndRethrows) {
+    HybridNodePlacement placement{hybridTable, true};
+
+    int executed = 0;
+    placement.run(CoreType::Performance, [&] {
+        executed++;
+    });
+    placement.run(CoreType::Efficient, [&] {
+        executed++;
+    });
+    EXPECT_EQ(executed, 2);
+
+    EXPECT_THROW(placement.run(CoreType::Efficient,
+                               [] {
+                                   throw std::runtime_error("node failed");
+                               }),
+                 std::runtime_error);
+}
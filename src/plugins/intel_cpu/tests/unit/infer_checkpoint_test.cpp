@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_common.h>
+
+#include "infer_checkpoint.h"
+
+using namespace ov::intel_cpu;
+
+TEST(InferCheckpointTest, InterruptsCanceledInference) {
+    InferCheckpoint checkpoint;
+    std::atomic<bool> canceled{false};
+    {
+        InferCheckpoint::Scope scope(checkpoint, &canceled, InferCheckpoint::Clock::time_point::max());
+        EXPECT_FALSE(checkpoint.isInterrupted());
+        EXPECT_NO_THROW(checkpoint.check());
+
+        canceled = true;
+        EXPECT_TRUE(checkpoint.isInterrupted());
+        EXPECT_THROW(checkpoint.check(), InferenceEngine::InferCancelled);
+    }
+    // the checkpoint is disarmed out of the inference
+    EXPECT_FALSE(checkpoint.isInterrupted());
+    EXPECT_NO_THROW(checkpoint.check());
+}
+
+TEST(InferCheckpointTest, InterruptsInferenceOutOfBudget) {
+    InferCheckpoint checkpoint;
+    std::atomic<bool> canceled{false};
+    {
+        InferCheckpoint::Scope scope(checkpoint, &canceled, InferCheckpoint::Clock::now() + std::chrono::hours(1));
+        EXPECT_FALSE(checkpoint.isInterrupted());
+        EXPECT_NO_THROW(checkpoint.check());
+    }
+    {
+        InferCheckpoint::Scope scope(checkpoint, &canceled, InferCheckpoint::Clock::now());
+        EXPECT_TRUE(checkpoint.isInterrupted());
+        EXPECT_THROW(checkpoint.check(), InferenceEngine::InferCancelled);
+    }
+    EXPECT_FALSE(checkpoint.isInterrupted());
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <transformations/cpu_opset/common/pass/sdpa_fusion.hpp>
+#include <transformations/cpu_opset/common/op/sdpa.hpp>
+#include <transformations/init_node_info.hpp>
+#include <openvino/pass/manager.hpp>
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithMask) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    const ov::PartialShape shape{-1, 8, -1, 64};
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto mask = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{-1, 1, 1, -1});
+        auto order = ov::opset1::Constant::create(ov::element::i32, ov::Shape{4}, {0, 1, 3, 2});
+        auto key_t = std::make_shared<ov::opset1::Transpose>(key, order);
+        auto scores = std::make_shared<ov::opset1::MatMul>(query, key_t);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {8.f});
+        auto scaled = std::make_shared<ov::opset1::Divide>(scores, scale);
+        auto masked = std::make_shared<ov::opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(masked, -1);
+        auto attention = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ attention }, ov::ParameterVector{ query, key, value, mask });
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto mask = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{-1, 1, 1, -1});
+        auto attention = std::make_shared<ScaledDotProductAttentionNode>(ov::OutputVector{query, key, value, mask}, 0.125f, false);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ attention }, ov::ParameterVector{ query, key, value, mask });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionCausal) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    const ov::PartialShape shape{-1, -1, 32};
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.25f});
+        auto query_scaled = std::make_shared<ov::opset1::Multiply>(query, scale);
+        auto scores = std::make_shared<ov::opset1::MatMul>(query_scaled, key, false, true);
+
+        // the causal mask as the PyTorch frontend builds it
+        auto zero = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        auto one = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {1});
+        auto axis = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {-2});
+        auto target_len = std::make_shared<ov::opset8::Gather>(std::make_shared<ov::opset4::ShapeOf>(query, ov::element::i32), axis, zero);
+        auto source_len = std::make_shared<ov::opset8::Gather>(std::make_shared<ov::opset4::ShapeOf>(key, ov::element::i32), axis, zero);
+        auto horizontal = std::make_shared<ov::opset4::Range>(zero, source_len, one, ov::element::i32);
+        auto stop = std::make_shared<ov::opset1::Add>(target_len, one);
+        auto vertical = std::make_shared<ov::opset4::Range>(one, stop, one, ov::element::i32);
+        auto triu = std::make_shared<ov::opset1::GreaterEqual>(std::make_shared<ov::opset1::Unsqueeze>(horizontal, zero),
+                                                               std::make_shared<ov::opset1::Unsqueeze>(vertical, one));
+        auto mask_shape = std::make_shared<ov::opset1::Concat>(ov::OutputVector{std::make_shared<ov::opset1::Unsqueeze>(target_len, zero),
+                                                                                std::make_shared<ov::opset1::Unsqueeze>(source_len, zero)}, 0);
+        auto minus_inf = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {-std::numeric_limits<float>::infinity()});
+        auto zero_f = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.f});
+        auto mask = std::make_shared<ov::opset1::Select>(triu, std::make_shared<ov::opset4::Broadcast>(minus_inf, mask_shape), zero_f);
+
+        auto masked = std::make_shared<ov::opset1::Add>(scores, mask);
+        auto softmax = std::make_shared<ov::opset1::Softmax>(masked, 2);
+        auto attention = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ attention }, ov::ParameterVector{ query, key, value });
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+        auto attention = std::make_shared<ScaledDotProductAttentionNode>(ov::OutputVector{query, key, value}, 0.25f, true);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ attention }, ov::ParameterVector{ query, key, value });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionSoftmaxNotOverKeys) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, 16});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, 16});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, 16});
+        auto scores = std::make_shared<ov::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(scores, 1);
+        auto attention = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ attention }, ov::ParameterVector{ query, key, value });
+        f_ref = f->clone();
+
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/dynamic_plan_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -345,7 +346,10 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
     auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
     auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
 
-    std::vector<MultiCache> vecCache(numThreads, MultiCache(capacity));
+    std::vector<std::unique_ptr<MultiCache>> vecCache;
+    for (size_t i = 0; i < numThreads; ++i) {
+        vecCache.emplace_back(new MultiCache(capacity));
+    }
 
     auto testRoutine = [&](MultiCache& cache) {
         //creating so we miss everytime
@@ -376,6 +380,201 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
     std::vector<ScopedThread> vecThreads;
     vecThreads.reserve(numThreads);
     for (size_t i = 0; i < numThreads; ++i) {
-        vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
+        vecThreads.emplace_back(std::thread(testRoutine, std::ref(*vecCache[i])));
+    }
+}
+
+TEST(MultiCacheTests, ShardedGetOrCreate) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int records = 10;
+    constexpr size_t numShards = 4;
+    constexpr size_t capacity = 2 * records * numShards;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, numShards);
+    ASSERT_TRUE(cache.isSharded());
+
+    //creating so we miss everytime
+    for (int i = 0; i < records; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(intResult.first, IntValueType());
+        ASSERT_EQ(*intResult.first, i);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
+        auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        ASSERT_NE(strResult.first, StrValueType());
+        ASSERT_EQ(*strResult.first, std::to_string(i));
+        ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    //always hit, the records of different types with the same hash do not collide
+    for (int i = 0; i < records; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(*intResult.first, i);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+        auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        ASSERT_EQ(*strResult.first, std::to_string(i));
+        ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, 2u * records);
+    ASSERT_EQ(statistics.misses, 2u * records);
+    ASSERT_EQ(statistics.evictions, 0u);
+    ASSERT_EQ(statistics.capacity, capacity);
+    ASSERT_EQ(statistics.size, 2u * records);
+}
+
+TEST(MultiCacheTests, ShardedCapacity) {
+    using IntValueType = std::shared_ptr<int>;
+
+    // the single shard fits 4 records
+    constexpr int records = 4;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(records, 1);
+
+    for (int i = 0; i < 2 * records; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(intResult.first, IntValueType());
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
     }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.evictions, static_cast<uint64_t>(records));
+    ASSERT_EQ(statistics.size, static_cast<size_t>(records));
+
+    //the most recently used records are kept
+    for (int i = records; i < 2 * records; ++i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+    //the old ones are evicted
+    ASSERT_EQ(cache.getOrCreate(IntKey{0}, intBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+
+    //zero capacity means nothing is stored
+    MultiCache emptyCache(0, 4);
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(emptyCache.getOrCreate(IntKey{0}, intBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    ASSERT_EQ(emptyCache.getStatistics().size, 0u);
+}
+
+TEST(MultiCacheTests, ShardedConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int records = 100;
+    constexpr size_t numThreads = 16;
+    constexpr size_t numShards = 8;
+    constexpr size_t capacity = 2 * records * numShards;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, numShards);
+    std::vector<std::vector<IntValueType>> results(numThreads, std::vector<IntValueType>(records));
+
+    auto testRoutine = [&](size_t thread) {
+        for (int i = 0; i < records; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+            results[thread][i] = intResult.first;
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    //all the threads finally share the same values
+    for (int i = 0; i < records; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, static_cast<uint64_t>((numThreads + 1) * records));
+    ASSERT_EQ(statistics.evictions, 0u);
+}
+
+TEST(MultiCacheTests, RecordsConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int records = 100;
+    constexpr size_t numThreads = 16;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    //the nodes of a graph update their parameters from several threads in both records mode cases
+    for (size_t capacity : {size_t(0), size_t(records / 2)}) {
+        MultiCache cache(capacity);
+
+        auto testRoutine = [&]() {
+            for (int i = 0; i < records; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        };
+
+        {
+            std::vector<ScopedThread> vecThreads;
+            vecThreads.reserve(numThreads);
+            for (size_t i = 0; i < numThreads; ++i) {
+                vecThreads.emplace_back(std::thread(testRoutine));
+            }
+        }
+
+        const auto statistics = cache.getStatistics();
+        ASSERT_EQ(statistics.hits + statistics.misses, static_cast<uint64_t>(2 * numThreads * records));
+        ASSERT_LE(statistics.size, 2 * capacity);
+    }
+}
+
+TEST(DynamicPlanCacheTests, FindAndEvict) {
+    constexpr size_t planSize = 100;
+    DynamicPlanCache cache(2 * planSize + planSize / 2, planSize);
+    ASSERT_EQ(cache.getCapacity(), 2u);
+
+    auto makePlan = [](size_t dim) {
+        return std::make_shared<DynamicPlanCache::Plan>(1, DynamicPlanCache::Dims{VectorDims{dim, 3}});
+    };
+    const DynamicPlanCache::Dims shapesA{{1, 3}, {2}};
+    const DynamicPlanCache::Dims shapesB{{2, 3}, {2}};
+    const DynamicPlanCache::Dims shapesC{{1, 3}, {4}};
+
+    ASSERT_EQ(cache.find(shapesA), nullptr);
+    auto planA = makePlan(1);
+    cache.add(shapesA, planA);
+    cache.add(shapesB, makePlan(2));
+    ASSERT_EQ(cache.find(shapesA), planA);
+    ASSERT_EQ(cache.find(shapesC), nullptr);
+
+    // B is the least recently used plan
+    cache.add(shapesC, makePlan(4));
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.find(shapesB), nullptr);
+    ASSERT_EQ(cache.find(shapesA), planA);
+    ASSERT_NE(cache.find(shapesC), nullptr);
+}
+
+TEST(DynamicPlanCacheTests, Empty) {
+    DynamicPlanCache cache(50, 100);
+    ASSERT_EQ(cache.getCapacity(), 0u);
+    const DynamicPlanCache::Dims shapes{VectorDims{1, 3}};
+    cache.add(shapes, std::make_shared<DynamicPlanCache::Plan>());
+    ASSERT_EQ(cache.size(), 0u);
+    ASSERT_EQ(cache.find(shapes), nullptr);
 }
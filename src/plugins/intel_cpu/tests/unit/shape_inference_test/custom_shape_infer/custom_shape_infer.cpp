@@ -21,6 +21,7 @@
 #include "shape_inference/custom/priorbox.hpp"
 #include "shape_inference/custom/priorbox_clustered.hpp"
 #include "shape_inference/custom/reshape.hpp"
+#include "shape_inference/custom/sdpa.hpp"
 #include "shape_inference/custom/shapeof.hpp"
 #include "shape_inference/custom/strided_slice.hpp"
 #include "shape_inference/custom/transpose.hpp"
@@ -59,6 +60,7 @@ public:
     INTEL_CPU_CUSTOM_SHAPE_INFER(node::PriorBoxShapeInferFactory, Type::PriorBox);
     INTEL_CPU_CUSTOM_SHAPE_INFER(node::PriorBoxClusteredShapeInferFactory, Type::PriorBoxClustered);
     INTEL_CPU_CUSTOM_SHAPE_INFER(node::NgramShapeInferFactory, Type::Ngram);
+    INTEL_CPU_CUSTOM_SHAPE_INFER(node::SDPAShapeInferFactory, Type::ScaledDotProductAttention);
     INTEL_CPU_CUSTOM_SHAPE_INFER(node::GatherShapeInferFactory, Type::Gather);
 #undef INTEL_CPU_CUSTOM_SHAPE_INFER
     }
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "common_test_utils/test_assertions.hpp"
+#include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include "custom_shape_infer.hpp"
+namespace ov {
+namespace intel_cpu {
+namespace unit_test {
+namespace cpu_shape_infer {
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(CpuShapeInfer, ScaledDotProductAttention) {
+    auto query = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto key = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto value = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto op = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(ov::OutputVector{query, key, value}, 0.125f, true);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 8, 35, 64}, {2, 1, 70, 64}, {2, 1, 70, 32}};
+    std::vector<StaticShape> static_output_shapes = {StaticShape{2, 8, 35, 32}};
+    unit_test::cpu_test_shape_infer(op.get(), static_input_shapes, static_output_shapes);
+}
+
+TEST(CpuShapeInfer, ScaledDotProductAttentionWithMask) {
+    auto query = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto key = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto value = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto mask = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto op = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(ov::OutputVector{query, key, value, mask}, 1.f, false);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 10, 16}, {4, 20, 16}, {1, 20, 8}, {10, 20}};
+    std::vector<StaticShape> static_output_shapes = {StaticShape{4, 10, 8}};
+    unit_test::cpu_test_shape_infer(op.get(), static_input_shapes, static_output_shapes);
+}
+
+TEST(CpuShapeInfer, ScaledDotProductAttentionIncompatibleBatch) {
+    auto query = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto key = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto value = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto op = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionNode>(ov::OutputVector{query, key, value}, 1.f, false);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 10, 16}, {3, 20, 16}, {3, 20, 8}};
+    std::vector<StaticShape> static_output_shapes = {StaticShape{}};
+    OV_EXPECT_THROW(unit_test::cpu_test_shape_infer(op.get(), static_input_shapes, static_output_shapes),
+                    ov::Exception,
+                    testing::HasSubstr("Incompatible ScaledDotProductAttention batch dimension"));
+}
+} // namespace cpu_shape_infer
+} // namespace unit_test
+} // namespace intel_cpu
+} // namespace ov
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "shared_streams_pool.h"
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr int poolStreams = 4;
+
+class SharedStreamsPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pool = std::make_shared<SharedStreamsPool>(executorManager(),
+                                                   IStreamsExecutor::Config{"SharedStreamsPoolTest", poolStreams, 1});
+    }
+
+    void TearDown() override {
+        pool.reset();
+        executorManager()->clear("SharedStreamsPoolTest");
+    }
+
+    // runs the tasks which are blocked until the gate is opened
+    static void runBlocked(PooledStreamsExecutor& executor, std::shared_future<void> gate, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            executor.run([gate] {
+                gate.wait();
+            });
+        }
+    }
+
+    static void waitIdle(PooledStreamsExecutor& executor) {
+        std::promise<void> done;
+        executor.run([&done] {
+            done.set_value();
+        });
+        done.get_future().wait();
+    }
+
+    SharedStreamsPool::Ptr pool;
+};
+
+}  // namespace
+
+TEST_F(SharedStreamsPoolTest, TasksRunAsDistinctModelStreams) {
+    constexpr int modelStreams = 2;
+    constexpr size_t tasks = 200;
+    auto executor = pool->createExecutor(modelStreams);
+
+    std::mutex mutex;
+    std::set<int> running;
+    std::atomic<size_t> violations{0};
+    std::atomic<size_t> finished{0};
+    std::promise<void> allFinished;
+    for (size_t i = 0; i < tasks; i++) {
+        executor->run([&] {
+            const int stream = executor->GetStreamId();
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                if (stream < 0 || stream >= modelStreams || !running.insert(stream).second)
+                    violations++;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds{50});
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                running.erase(stream);
+            }
+            if (++finished == tasks)
+                allFinished.set_value();
+        });
+    }
+    allFinished.get_future().wait();
+    EXPECT_EQ(violations.load(), 0);
+}
+
+TEST_F(SharedStreamsPoolTest, StreamsFollowQueueDepth) {
+    auto first = pool->createExecutor(poolStreams);
+    auto second = pool->createExecutor(poolStreams);
+    EXPECT_EQ(first->getAllowedStreams(), poolStreams / 2);
+    EXPECT_EQ(second->getAllowedStreams(), poolStreams / 2);
+
+    std::promise<void> firstGate;
+    const auto firstOpened = firstGate.get_future().share();
+    runBlocked(*first, firstOpened, 2 * poolStreams);
+    // the shares are recomputed on a submission after the rebalancing interval
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    runBlocked(*first, firstOpened, 1);
+    EXPECT_EQ(first->getAllowedStreams(), poolStreams);
+    EXPECT_EQ(second->getAllowedStreams(), 1);
+    firstGate.set_value();
+    waitIdle(*first);
+
+    std::promise<void> secondGate;
+    const auto secondOpened = secondGate.get_future().share();
+    runBlocked(*second, secondOpened, 2 * poolStreams);
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    runBlocked(*second, secondOpened, 1);
+    EXPECT_EQ(second->getAllowedStreams(), poolStreams);
+    EXPECT_EQ(first->getAllowedStreams(), 1);
+    secondGate.set_value();
+    waitIdle(*second);
+    EXPECT_EQ(second->getQueueDepth(), 0);
+}
+
+TEST_F(SharedStreamsPoolTest, ExecutorReleasedByOwnTask) {
+    auto executor = pool->createExecutor(poolStreams);
+    auto released = std::make_shared<std::promise<void>>();
+    auto done = released->get_future();
+    std::promise<void> gate;
+    const auto opened = gate.get_future().share();
+    // the task holds the last reference to its executor, so the executor is destroyed on the pool stream
+    executor->run([executor, released, opened]() mutable {
+        opened.wait();
+        executor.reset();
+        released->set_value();
+    });
+    executor.reset();
+    gate.set_value();
+    ASSERT_EQ(done.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+
+    // the pool keeps serving the other models
+    auto other = pool->createExecutor(poolStreams);
+    waitIdle(*other);
+    EXPECT_EQ(other->getQueueDepth(), 0);
+}
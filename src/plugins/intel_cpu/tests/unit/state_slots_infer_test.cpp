@@ -0,0 +1,187 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <ngraph_functions/builders.hpp>
+#include <openvino/op/util/variable.hpp>
+#include <openvino/opsets/opset6.hpp>
+
+#include "exec_network.h"
+#include "infer_request.h"
+#include "internal_properties.hpp"
+#include "plugin.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t stateSize = 4;
+
+// out = state + x * W, the new state is the output, so every row accumulates the inputs of its own sequence
+std::shared_ptr<ov::Model> makeStatefulModel(size_t batch, size_t size, bool withWeights) {
+    const auto precision = ov::element::f32;
+    auto x = std::make_shared<ov::opset6::Parameter>(precision, ov::Shape{batch, size});
+    x->set_friendly_name("x");
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{batch, size}, precision, "state"});
+    auto init = ngraph::builder::makeConstant<float>(precision, {batch, size}, {0.f});
+    auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+    std::shared_ptr<ov::Node> update = x;
+    if (withWeights) {
+        auto weights = ngraph::builder::makeConstant<float>(precision, {size, size}, {}, true);
+        update = std::make_shared<ov::opset6::MatMul>(x, weights);
+    }
+    auto sum = std::make_shared<ov::opset6::Add>(readValue, update);
+    sum->set_friendly_name("out");
+    auto assign = std::make_shared<ov::opset6::Assign>(sum, variable);
+    auto result = std::make_shared<ov::opset6::Result>(sum);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{x},
+                                       "StateSlots");
+}
+
+class StateSlotsInferTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ExecNetwork> compile(size_t batch, size_t size, size_t slots, bool withWeights) {
+        CNNNetwork network(makeStatefulModel(batch, size, withWeights));
+        auto execNetwork = std::dynamic_pointer_cast<ExecNetwork>(
+            engine->LoadNetwork(network, {{ov::intel_cpu::state_slots.name(), std::to_string(slots)}})._ptr);
+        EXPECT_NE(execNetwork, nullptr);
+        return execNetwork;
+    }
+
+    static std::shared_ptr<InferRequestBase> createRequest(const std::shared_ptr<ExecNetwork>& execNetwork) {
+        auto request = std::dynamic_pointer_cast<InferRequestBase>(
+            execNetwork->CreateInferRequestImpl(execNetwork->getInputs(), execNetwork->getOutputs()));
+        EXPECT_NE(request, nullptr);
+        return request;
+    }
+
+    // the row r of x is filled with rowValues[r]
+    static void setRows(InferRequestBase& request, const std::vector<float>& rowValues) {
+        auto blob = request.GetBlob("x");
+        auto* data = blob->buffer().as<float*>();
+        const auto size = blob->size() / rowValues.size();
+        for (size_t r = 0; r < rowValues.size(); r++)
+            std::fill(data + r * size, data + (r + 1) * size, rowValues[r]);
+    }
+
+    static std::vector<float> getRows(InferRequestBase& request) {
+        auto blob = request.GetBlob("out");
+        const auto* data = blob->cbuffer().as<const float*>();
+        const auto rows = blob->getTensorDesc().getDims()[0];
+        const auto size = blob->size() / rows;
+        std::vector<float> result;
+        for (size_t r = 0; r < rows; r++) {
+            // the rows are uniform
+            for (size_t i = 1; i < size; i++)
+                EXPECT_EQ(data[r * size + i], data[r * size]);
+            result.push_back(data[r * size]);
+        }
+        return result;
+    }
+
+    static float getSlot(StateSlots& slots, int slot) {
+        auto state = slots.getState("state", slot);
+        return static_cast<const float*>(state->getData())[0];
+    }
+
+    std::shared_ptr<Engine> engine = std::make_shared<Engine>();
+};
+
+}  // namespace
+
+TEST_F(StateSlotsInferTest, RequestsShareSlots) {
+    auto execNetwork = compile(2, stateSize, 4, false);
+    ASSERT_NE(execNetwork->GetStateSlots(), nullptr);
+    auto& slots = *execNetwork->GetStateSlots();
+    ASSERT_EQ(slots.getCapacity(), 4);
+
+    auto first = createRequest(execNetwork);
+    auto second = createRequest(execNetwork);
+    const auto a = slots.acquire();
+    const auto b = slots.acquire();
+    const auto c = slots.acquire();
+
+    // MemoryInput gathers the states of the bound slots, the new rows are scattered back
+    first->SetStateSlots({a, b});
+    setRows(*first, {1.f, 2.f});
+    first->Infer();
+    EXPECT_EQ(getRows(*first), (std::vector<float>{1.f, 2.f}));
+
+    // the sequence a continues on the other request, in the other row, next to a new sequence
+    second->SetStateSlots({c, a});
+    setRows(*second, {10.f, 100.f});
+    second->Infer();
+    EXPECT_EQ(getRows(*second), (std::vector<float>{10.f, 101.f}));
+
+    // the unbound row reads zeros and its new state is dropped
+    first->SetStateSlots({-1, b});
+    setRows(*first, {5.f, 5.f});
+    first->Infer();
+    EXPECT_EQ(getRows(*first), (std::vector<float>{5.f, 7.f}));
+
+    EXPECT_EQ(getSlot(slots, a), 101.f);
+    EXPECT_EQ(getSlot(slots, b), 7.f);
+    EXPECT_EQ(getSlot(slots, c), 10.f);
+
+    // the sequence b leaves, a new one takes its slot with the zero state
+    slots.release(b);
+    const auto d = slots.acquire();
+    EXPECT_EQ(d, b);
+    first->SetStateSlots({a, d});
+    setRows(*first, {1.f, 3.f});
+    first->Infer();
+    EXPECT_EQ(getRows(*first), (std::vector<float>{102.f, 3.f}));
+
+    // without the bindings the request works with its own variable states, untouched by the slots
+    first->SetStateSlots({});
+    setRows(*first, {1.f, 1.f});
+    first->Infer();
+    EXPECT_EQ(getRows(*first), (std::vector<float>{1.f, 1.f}));
+    EXPECT_EQ(getSlot(slots, a), 102.f);
+}
+
+class StateSlotsThroughputTest : public StateSlotsInferTest, public ::testing::WithParamInterface<size_t> {};
+
+// Measures the tokens per second of the sequences served by one batched request, each row bound to its own slot
+TEST_P(StateSlotsThroughputTest, TokensPerSecond) {
+    constexpr size_t hiddenSize = 512;
+    constexpr size_t steps = 200;
+    const size_t batch = GetParam();
+
+    auto execNetwork = compile(batch, hiddenSize, batch, true);
+    ASSERT_NE(execNetwork->GetStateSlots(), nullptr);
+    auto& slots = *execNetwork->GetStateSlots();
+    auto request = createRequest(execNetwork);
+
+    std::vector<int> rowSlots;
+    for (size_t r = 0; r < batch; r++)
+        rowSlots.push_back(slots.acquire());
+    request->SetStateSlots(rowSlots);
+    setRows(*request, std::vector<float>(batch, 0.01f));
+
+    // warm up
+    request->Infer();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < steps; i++)
+        request->Infer();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "[ THROUGHPUT ] batch: " << batch << ", " << batch * steps / elapsed.count() << " tokens/s, "
+              << elapsed.count() * 1e6 / steps << " us per step" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Batch,
+                         StateSlotsThroughputTest,
+                         ::testing::Values(1, 4, 16, 64),
+                         [](const ::testing::TestParamInfo<size_t>& info) {
+                             return "batch_" + std::to_string(info.param);
+                         });
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "memory_state.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<float> readRows(const IMemory& mem) {
+    const auto* data = static_cast<const float*>(mem.getData());
+    return std::vector<float>(data, data + mem.getShape().getElementsCount());
+}
+
+}  // namespace
+
+TEST(StateSlotsTest, GathersAndScattersRows) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    // a batch of 2 rows of 3 elements
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{2, 3});
+    StateSlots slots(eng, 3, {{"state", desc}});
+
+    const auto first = slots.acquire();
+    const auto second = slots.acquire();
+    ASSERT_NE(first, second);
+
+    // the acquired slots are zero filled
+    Memory batch(eng, desc);
+    std::vector<float> newState{1, 2, 3, 4, 5, 6};
+    cpu_memcpy(batch.getData(), newState.data(), newState.size() * sizeof(float));
+    slots.gather("state", {first, second}, batch);
+    EXPECT_EQ(readRows(batch), std::vector<float>(6, 0.f));
+
+    Memory src(eng, desc);
+    cpu_memcpy(src.getData(), newState.data(), newState.size() * sizeof(float));
+    slots.scatter("state", {first, second}, src);
+
+    // the rows follow the slots they are bound to, the unbound rows read zeros
+    slots.gather("state", {second, -1}, batch);
+    EXPECT_EQ(readRows(batch), (std::vector<float>{4, 5, 6, 0, 0, 0}));
+    EXPECT_EQ(readRows(*slots.getState("state", first)), (std::vector<float>{1, 2, 3}));
+
+    // the released slot is given to a new sequence with the zero state
+    slots.release(first);
+    const auto third = slots.acquire();
+    EXPECT_EQ(third, first);
+    slots.gather("state", {second, third}, batch);
+    EXPECT_EQ(readRows(batch), (std::vector<float>{4, 5, 6, 0, 0, 0}));
+
+    // the unbound rows are not stored
+    slots.scatter("state", {-1, third}, src);
+    slots.gather("state", {second, third}, batch);
+    EXPECT_EQ(readRows(batch), (std::vector<float>{4, 5, 6, 4, 5, 6}));
+
+    slots.reset(second);
+    slots.gather("state", {second, third}, batch);
+    EXPECT_EQ(readRows(batch), (std::vector<float>{0, 0, 0, 4, 5, 6}));
+}
+
+TEST(StateSlotsTest, ConvertsScatteredRows) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{2, 2});
+    StateSlots slots(eng, 2, {{"state", desc}});
+    const auto slot = slots.acquire();
+
+    Memory src(eng, std::make_shared<CpuBlockedMemoryDesc>(Precision::I32, Shape{2, 2}));
+    std::vector<int32_t> newState{1, 2, 3, 4};
+    cpu_memcpy(src.getData(), newState.data(), newState.size() * sizeof(int32_t));
+    slots.scatter("state", {-1, slot}, src);
+    EXPECT_EQ(readRows(*slots.getState("state", slot)), (std::vector<float>{3, 4}));
+}
+
+TEST(StateSlotsTest, RejectsWrongBindings) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{2, 3});
+    StateSlots slots(eng, 1, {{"state", desc}});
+    const auto slot = slots.acquire();
+    EXPECT_ANY_THROW(slots.acquire());
+
+    Memory batch(eng, desc);
+    EXPECT_ANY_THROW(slots.gather("state", {slot}, batch));
+    EXPECT_ANY_THROW(slots.gather("unknown", {slot, -1}, batch));
+    EXPECT_ANY_THROW(slots.getState("state", 1));
+    EXPECT_ANY_THROW(slots.release(-1));
+}
@@ -30,6 +30,8 @@ public:
 
     void set_callback(std::function<void(std::exception_ptr)> callback) override;
 
+    void set_property(const ov::AnyMap& properties) override;
+
     void infer() override;
 
     std::vector<ov::ProfilingInfo> get_profiling_info() const override;
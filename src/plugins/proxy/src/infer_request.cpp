@@ -39,6 +39,10 @@ void ov::proxy::InferRequest::set_callback(std::function<void(std::exception_ptr
     m_infer_request->set_callback(callback);
 }
 
+void ov::proxy::InferRequest::set_property(const ov::AnyMap& properties) {
+    m_infer_request->set_property(properties);
+}
+
 void ov::proxy::InferRequest::infer() {
     m_infer_request->infer();
 }